@@ -0,0 +1,135 @@
+#pragma once
+
+#include "ProblemInstance/PrecedenceGraph.hpp"
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Solution/Incumbent.hpp"
+#include "Solution/Solution.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// precedence tree branch and bound: every level starts one eligible job in one of its modes at its earliest
+// feasible time, never before the job started at the previous level
+class BranchAndBound
+{
+  public:
+    explicit BranchAndBound(const ProblemInstance &problem_instance);
+    BranchAndBound(const BranchAndBound &) = delete;
+    BranchAndBound &operator=(const BranchAndBound &) = delete;
+
+    Solution solve();
+    void add_incumbent_listener(IncumbentListener listener);
+    void set_stop_token(std::stop_token stop_token);
+    // the better schedules other engines publish to this store tighten the pruning bound during the search
+    void set_incumbent_source(const IncumbentStore &incumbent_store);
+
+  private:
+    struct JobMode
+    {
+        size_t mode_id;
+        size_t duration;
+        std::vector<size_t> demands;
+    };
+
+    // a subtree root, rebuilt by replaying the (job, mode) decisions from the root
+    using Node = std::vector<std::pair<size_t, size_t>>;
+
+    struct WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<Node> nodes;
+    };
+
+    // the (job, mode, finish time) still running after the last start time of a partial schedule, sorted by job
+    struct CutsetEntry
+    {
+        size_t last_start;
+        std::vector<std::array<size_t, 3>> running_jobs;
+    };
+
+    // partial schedules already explored, grouped by their set of scheduled jobs
+    class CutsetStore
+    {
+      public:
+        explicit CutsetStore(size_t max_nb_entries);
+
+        // true when an explored partial schedule with the same jobs dominates, otherwise the entry is stored
+        bool is_dominated(const std::vector<uint64_t> &scheduled_jobs, CutsetEntry entry,
+                          const std::vector<JobMode> &modes);
+
+      private:
+        struct Hash
+        {
+            size_t operator()(const std::vector<uint64_t> &bitset) const;
+        };
+
+        struct Shard
+        {
+            std::mutex mutex;
+            std::unordered_map<std::vector<uint64_t>, std::vector<CutsetEntry>, Hash> entries;
+        };
+
+        static constexpr size_t nb_shards = 64;
+        std::array<Shard, nb_shards> shards;
+        size_t max_nb_entries;
+        std::atomic<size_t> nb_entries = 0;
+    };
+
+    struct SearchState
+    {
+        SearchState(std::vector<IncumbentListener> listeners, size_t nb_workers,
+                    std::chrono::steady_clock::time_point deadline, size_t makespan_lower_bound);
+
+        // after a node was donated, or once the search is exhausted or stopped
+        void wake_idle_workers();
+
+        std::chrono::steady_clock::time_point deadline;
+        size_t makespan_lower_bound;
+        std::vector<WorkerQueue> queues;
+        // nodes waiting in a queue or being explored
+        std::atomic<size_t> nb_pending_nodes = 0;
+        std::atomic<size_t> nb_idle_workers = 0;
+        std::mutex idle_mutex;
+        std::condition_variable idle_condition;
+        std::atomic<bool> stopped = false;
+        std::atomic<size_t> best_makespan;
+        CutsetStore cutset_store;
+        std::mutex publisher_mutex;
+        IncumbentPublisher incumbent_publisher;
+        std::optional<Incumbent> best;
+        std::exception_ptr worker_exception;
+    };
+
+    class Worker;
+
+    void run_worker(size_t worker_index, SearchState &search_state) const;
+    std::optional<Node> take_node(size_t worker_index, SearchState &search_state) const;
+    void publish(SearchState &search_state, const std::vector<size_t> &start_times,
+                 const std::vector<size_t> &job_modes) const;
+    void import_incumbent(SearchState &search_state) const;
+
+    PrecedenceGraph precedence_graph;
+    size_t makespan_lower_bound = 0;
+    std::vector<size_t> capacities;
+    // modes[first_modes[j]] to modes[first_modes[j + 1] - 1] are the efficient modes of job j
+    std::vector<JobMode> modes;
+    std::vector<size_t> first_modes;
+    std::vector<size_t> min_durations;
+    // smallest duration times demand over the modes of a job, per resource
+    std::vector<std::vector<size_t>> min_energies;
+    std::vector<size_t> tails;
+    size_t horizon = 0;
+    std::vector<IncumbentListener> incumbent_listeners;
+    std::stop_token stop_token;
+    const IncumbentStore *incumbent_source = nullptr;
+};
@@ -1,8 +1,15 @@
 #pragma once
 
+#include "ProblemInstance/PrecedenceGraph.hpp"
 #include "ProblemInstance/ProblemInstance.hpp"
+#include "Solution/Incumbent.hpp"
+#include "Settings.hpp"
 #include "Solution/Solution.hpp"
+#include <functional>
 #include <ilcp/cp.h>
+#include <map>
+#include <stop_token>
+#include <string>
 
 class CPSolver
 {
@@ -10,25 +17,78 @@ class CPSolver
     explicit CPSolver(const ProblemInstance &);
     CPSolver(const CPSolver &) = delete;
     CPSolver &operator=(const CPSolver &) = delete;
+    ~CPSolver();
 
-    Solution solve();
+    Solution solve(double time_limit = Settings::Solver::MAX_RUNTIME);
+    void add_incumbent_listener(IncumbentListener listener);
+    void set_nb_workers(size_t nb_workers);
+    // a stop request aborts the running search, the best solution found so far is kept
+    void set_stop_token(std::stop_token stop_token);
+
+    // edits of the persistent model, the next solve is warm started from the last solution found
+    void set_release_time(const std::string &job_id, size_t release_time);
+    // the mode stays fixed when the job is unfrozen, freezing or restricting the job may select another mode meanwhile
+    void fix_mode(const std::string &job_id, size_t mode_id);
+    void freeze_job(const std::string &job_id, size_t start_time, size_t mode_id);
+    // freezes every job of the solution starting before the given time
+    void freeze_schedule_prefix(const Solution &solution, size_t time);
+    // the job keeps its mode and cannot start later than the given time, it may still be moved earlier
+    void restrict_job(const std::string &job_id, size_t latest_start_time, size_t mode_id);
+    void unfreeze_job(const std::string &job_id);
+    void unfreeze_jobs(const std::vector<std::string> &job_ids);
+    void set_starting_point(const Solution &solution);
+
+    static const std::map<std::string, IloCP::ParameterValues, std::less<>> &get_search_types();
+
+    // a task ordering rule gives a priority per job, the jobs with the smallest priority are branched on first
+    using TaskOrderingRule = std::vector<double> (CPSolver::*)() const;
+    static const std::map<std::string, TaskOrderingRule, std::less<>> &get_task_ordering_rules();
+    // a mode preference rule scores a mode, the modes with the smallest score are tried first
+    using ModePreferenceRule = double (*)(const Mode &mode, const std::vector<Resource> &resources);
+    static const std::map<std::string, ModePreferenceRule, std::less<>> &get_mode_preference_rules();
 
   private:
+    void build_model();
     void init_resource_arrays(const IloModel &model);
     void add_job_start_time_constraints(const IloModel &model);
     void add_job_modes_constraints(const IloModel &model);
     void add_precedence_constraints(const IloModel &model) const;
     void add_capacity_constraints(const IloModel &model) const;
-    void solve_cp_model(IloCP &cp, const IloModel &model) const;
-    void set_solution_status(const IloCP &cp, Solution &solution) const;
+    void add_redundant_cumulative_constraints(const IloModel &model) const;
+    void add_unary_resource_constraints(const IloModel &model) const;
+    void update_start_time_bounds();
+    // makes the mode present and the other modes of the job absent
+    void select_mode(const std::string &job_id, size_t mode_id);
+    std::vector<double> compute_latest_finish_times() const;
+    std::vector<double> compute_total_floats() const;
+    void add_search_phases(const IloModel &model);
+    void solve_cp_model(Solution &solution, double time_limit);
+    std::string get_solver_configuration() const;
+    void set_solution_status(const IloCP &cp, Solution &solution, bool solution_found) const;
     void set_solution(const IloCP &cp, Solution &solution) const;
-    void add_objective(const IloModel &) const;
+    void add_objective(const IloModel &);
 
     const ProblemInstance &problem_instance;
+    PrecedenceGraph precedence_graph;
+    IloEnv env;
+    IloModel model;
+    IloCP cp;
+    IloSolution starting_point;
+    IloSearchPhaseArray search_phases;
+    bool has_starting_point = false;
+    size_t nb_workers;
     IloCumulFunctionExprArray processes;
     IloIntArray capacities;
     IloIntervalVarArray tasks;
     IloIntervalVarArray2 modes;
     IloIntExprArray starts;
     IloIntExprArray ends;
+    IloIntExpr makespan;
+    IloConstraint makespan_lower_bound_constraint;
+    std::vector<size_t> release_times;
+    std::vector<bool> frozen_jobs;
+    // mode ids given to fix_mode, 0 while the job may take any mode
+    std::vector<size_t> fixed_mode_ids;
+    std::vector<IncumbentListener> incumbent_listeners;
+    std::stop_token stop_token;
 };
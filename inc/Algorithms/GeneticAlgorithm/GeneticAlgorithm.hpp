@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Algorithms/ScheduleGeneration/ScheduleDecoder.hpp"
+#include "Algorithms/ScheduleGeneration/ScheduleEncoding.hpp"
+#include "ProblemInstance/PrecedenceGraph.hpp"
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Shared/Random.hpp"
+#include "Solution/Incumbent.hpp"
+#include "Solution/Solution.hpp"
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <vector>
+
+// island model genetic algorithm on activity lists and mode lists: every thread evolves its own population and
+// sends its best individual to the next island at a fixed number of generations
+class GeneticAlgorithm
+{
+  public:
+    explicit GeneticAlgorithm(const ProblemInstance &problem_instance);
+    GeneticAlgorithm(const GeneticAlgorithm &) = delete;
+    GeneticAlgorithm &operator=(const GeneticAlgorithm &) = delete;
+
+    Solution solve();
+    void add_incumbent_listener(IncumbentListener listener);
+    void set_stop_token(std::stop_token stop_token);
+    // the better schedules other engines publish to this store join the first island at its migrations
+    void set_incumbent_source(const IncumbentStore &incumbent_store);
+    // every island evolves with its own stream of the seed, make_seed(0) by default
+    void set_seed(uint64_t seed);
+
+  private:
+    // single slot mailbox: the sender exchanges in a new immigrant and frees the one not taken yet,
+    // the receiver exchanges in a null pointer and owns what it took
+    struct Island
+    {
+        ~Island();
+        void send(const ScheduleEncoding &encoding);
+        std::unique_ptr<ScheduleEncoding> receive();
+
+        std::atomic<ScheduleEncoding *> immigrant = nullptr;
+    };
+
+    struct SearchState
+    {
+        SearchState(std::vector<IncumbentListener> listeners, size_t makespan_lower_bound, size_t nb_islands,
+                    std::chrono::steady_clock::time_point deadline);
+
+        std::chrono::steady_clock::time_point deadline;
+        std::vector<Island> islands;
+        std::atomic<size_t> nb_generations = 0;
+        SharedIncumbent shared_incumbent;
+        std::mutex exception_mutex;
+        std::exception_ptr worker_exception;
+    };
+
+    void run_island(size_t island_index, SearchState &search_state) const;
+    // decodes a whole generation of offspring before any of them enters the population, the generations of the
+    // islands are decoded in parallel so that one generation is not split again over the threads
+    void evaluate(ScheduleDecoder &decoder, std::vector<ScheduleEncoding> &batch) const;
+    const ScheduleEncoding &select_parent(const std::vector<ScheduleEncoding> &population,
+                                          RandomGenerator &generator) const;
+    // two-point crossover of the activity lists keeps the relative order of each parent so the child stays
+    // precedence feasible, the mode lists are crossed at two job indices
+    void crossover(const ScheduleEncoding &mother, const ScheduleEncoding &father, RandomGenerator &generator,
+                   ScheduleEncoding &child) const;
+    // swaps unrelated neighbours of the activity list and draws new modes, the non-executable ones are repaired
+    void mutate(const ScheduleDecoder &decoder, RandomGenerator &generator, ScheduleEncoding &encoding) const;
+    void publish(SearchState &search_state, ScheduleDecoder &decoder, const ScheduleEncoding &encoding) const;
+
+    const ProblemInstance &problem_instance;
+    PrecedenceGraph precedence_graph;
+    size_t makespan_lower_bound = 0;
+    std::vector<IncumbentListener> incumbent_listeners;
+    std::stop_token stop_token;
+    const IncumbentStore *incumbent_source = nullptr;
+    uint64_t random_seed = make_seed(0);
+};
@@ -30,11 +30,45 @@ class ConstraintModelBuilder
 
     void add_renewable_resource_constraints(const TimeIndexedModelVariableMapping::map3to1 &x);
 
+    SparseMatrix<double>::Row get_renewable_resource_row(const TimeIndexedModelVariableMapping::map3to1 &x, size_t t,
+                                                         size_t k) const;
+
+    void add_makespan_constraints(const TimeIndexedModelVariableMapping::map1to1 &s,
+                                  const TimeIndexedModelVariableMapping::map1to1 &p,
+                                  const TimeIndexedModelVariableMapping::map1to1 &cMax);
+
+    void add_mode_selection_constraints(const TimeIndexedModelVariableMapping::map3to1 &mu,
+                                        const TimeIndexedModelVariableMapping::map1to1 &p);
+
+    void add_step_start_time_constraints(const TimeIndexedModelVariableMapping::map3to1 &x,
+                                         const TimeIndexedModelVariableMapping::map3to1 &mu,
+                                         const TimeIndexedModelVariableMapping::map1to1 &s);
+
+    void add_step_renewable_resource_constraints(const TimeIndexedModelVariableMapping::map3to1 &x);
+
+    void add_disaggregated_precedence_constraints(const TimeIndexedModelVariableMapping::map3to1 &x);
+
+    void add_event_sequence_constraints(const TimeIndexedModelVariableMapping::map3to1 &z,
+                                        const TimeIndexedModelVariableMapping::map3to1 &mu,
+                                        const TimeIndexedModelVariableMapping::map1to1 &tau);
+
+    void add_event_start_time_constraints(const TimeIndexedModelVariableMapping::map3to1 &z,
+                                          const TimeIndexedModelVariableMapping::map1to1 &tau,
+                                          const TimeIndexedModelVariableMapping::map1to1 &s,
+                                          const TimeIndexedModelVariableMapping::map1to1 &p);
+
+    void add_event_precedence_constraints(const TimeIndexedModelVariableMapping::map3to1 &z);
+
+    void add_event_renewable_resource_constraints(const TimeIndexedModelVariableMapping::map3to1 &z);
+
     void add_constraint(SparseMatrix<double>::Row &row, Operator op, const double &b, const std::string &conDesc);
 
   private:
     void add_resource_constraints_helper(const TimeIndexedModelVariableMapping::map3to1 &x, const JobConstPtr &job,
                                          SparseMatrix<double>::Row &row, size_t t, size_t k) const;
+    void add_event_terms_helper(const TimeIndexedModelVariableMapping::map3to1 &z, const JobConstPtr &job,
+                                SparseMatrix<double>::Row &row, long e, double coefficient) const;
+    void merge_row_elements(SparseMatrix<double>::Row &row) const;
     size_t constraints_counter = 0;
     const ProblemInstance &problem_instance;
     SparseMatrix<double> constraint_matrix;
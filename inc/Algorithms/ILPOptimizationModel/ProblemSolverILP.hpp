@@ -2,9 +2,16 @@
 
 #include "Algorithms/ILPOptimizationModel/ConstraintModelBuilder.hpp"
 #include "Algorithms/ILPOptimizationModel/VariableMappingBuilder.hpp"
+#include "External/ILPSolverModel/ILPPresolver.hpp"
+#include "External/ILPSolverModel/ILPSolverInterface.hpp"
 #include "External/ILPSolverModel/ILPSolverModel.hpp"
 #include "Settings.hpp"
+#include "Solution/Incumbent.hpp"
 #include "Solution/Solution.hpp"
+#include <functional>
+#include <map>
+#include <stop_token>
+#include <string>
 
 class ProblemSolverILP
 {
@@ -13,11 +20,40 @@ class ProblemSolverILP
     ProblemSolverILP(const ProblemSolverILP &) = delete;
     ProblemSolverILP &operator=(const ProblemSolverILP &) = delete;
 
-    Solution solve(Solution &init_solution, double rel_gap = Settings::Solver::ILP_RELATIVE_GAP,
+    // the job allocations of the initial solution give a MIP start when INIT_ILP_SOLUTION is set
+    Solution solve(const Solution &init_solution, double rel_gap = Settings::Solver::ILP_RELATIVE_GAP,
                    double time_limit = Settings::Solver::MAX_RUNTIME) const;
+    void add_incumbent_listener(IncumbentListener listener);
+    void set_stop_token(std::stop_token stop_token);
+
+    struct FormulationBuilder
+    {
+        void (ProblemSolverILP::*add_variables)();
+        void (ProblemSolverILP::*add_constraints)(ConstraintModelBuilder &);
+        bool supports_lazy_resource_constraints;
+    };
+    static const std::map<std::string, FormulationBuilder, std::less<>> &get_formulation_registry();
 
   private:
-    void construct(ConstraintModelBuilder &generator);
+    void construct(const ProblemInstance &problem_instance);
+    void add_pulse_formulation_variables();
+    void add_step_formulation_variables();
+    void add_event_formulation_variables();
+    void construct_pulse_formulation(ConstraintModelBuilder &constraint_model_builder);
+    void construct_step_formulation(ConstraintModelBuilder &constraint_model_builder);
+    void construct_disaggregated_formulation(ConstraintModelBuilder &constraint_model_builder);
+    void construct_event_formulation(ConstraintModelBuilder &constraint_model_builder);
+    void presolve();
+    std::vector<LazyConstraint> separate_renewable_resource_constraints(const std::vector<double> &solution) const;
+    std::vector<JobAllocation> get_job_allocations(const std::vector<double> &values) const;
+    // values of the reduced model variables, NaN for those the schedule does not determine
+    std::vector<double> get_start_values(const std::vector<JobAllocation> &job_allocations) const;
+    size_t get_selected_mode(const TimeIndexedModelVariableMapping::JobVariableBlock &block,
+                             const std::vector<double> &values) const;
+    const ProblemInstance &problem_instance;
     TimeIndexedModelVariableMapping variable_mapping_ilp;
     ILPSolverModel ilp_model;
+    ILPPresolver presolver;
+    std::vector<IncumbentListener> incumbent_listeners;
+    std::stop_token stop_token;
 };
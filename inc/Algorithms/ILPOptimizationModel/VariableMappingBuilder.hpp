@@ -13,11 +13,24 @@ class TimeIndexedModelVariableMapping
     TimeIndexedModelVariableMapping &operator=(const TimeIndexedModelVariableMapping &) = delete;
 
     size_t get_nb_variables() const;
+    std::vector<size_t> get_out_of_window_start_time_variables(bool cumulative) const;
 
     using map1to1 = std::map<std::string, size_t, NumericalStringComparator>;
     using map2to1 = std::map<std::tuple<std::string, std::string>, size_t>;
     using map3to1 = std::map<std::tuple<std::string, std::string, std::string>, size_t>;
 
+    // dense variable indices of a job, the mode selection variables are laid out as [block][mode]
+    struct JobVariableBlock
+    {
+        JobConstPtr job;
+        size_t start_time_variable;
+        size_t processing_time_variable;
+        size_t first_mode_variable;
+        size_t last_mode_variable;
+    };
+
+    const std::vector<JobVariableBlock> &get_job_variable_blocks() const;
+
   private:
     const ProblemInstance &problem_instance;
     void add_objective_function_variables();
@@ -25,22 +38,22 @@ class TimeIndexedModelVariableMapping
     void add_jobs_processing_time_variables();
     void add_jobs_start_time_variables();
     void add_jobs_resources_allocation_variables();
+    void add_jobs_mode_variables();
+    void add_event_variables();
 
     map1to1 c_max;
     map3to1 x;
     map1to1 p;
     map1to1 s;
     map2to1 y;
+    map3to1 mu;
+    map1to1 tau;
+    map3to1 z;
 
+    std::vector<JobVariableBlock> job_variable_blocks;
     std::vector<DecisionVariable> variables;
     std::vector<std::string> var_desc;
 
     friend class ProblemSolverILP;
 };
 
-TimeIndexedModelVariableMapping::map1to1 lookup(const std::vector<double> &solution,
-                                                const TimeIndexedModelVariableMapping::map1to1 &mapping);
-TimeIndexedModelVariableMapping::map2to1 lookup(const std::vector<double> &solution,
-                                                const TimeIndexedModelVariableMapping::map2to1 &mapping);
-TimeIndexedModelVariableMapping::map1to1 lookup(const std::vector<double> &solution,
-                                                const TimeIndexedModelVariableMapping::map3to1 &mapping);
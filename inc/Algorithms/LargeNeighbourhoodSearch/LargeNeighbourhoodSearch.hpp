@@ -0,0 +1,73 @@
+#pragma once
+
+#include "ProblemInstance/PrecedenceGraph.hpp"
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Shared/Random.hpp"
+#include "Solution/Incumbent.hpp"
+#include "Solution/Solution.hpp"
+#include <chrono>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+class LargeNeighbourhoodSearch
+{
+  public:
+    explicit LargeNeighbourhoodSearch(const ProblemInstance &problem_instance);
+    LargeNeighbourhoodSearch(const LargeNeighbourhoodSearch &) = delete;
+    LargeNeighbourhoodSearch &operator=(const LargeNeighbourhoodSearch &) = delete;
+
+    // without job allocations in the initial solution a first schedule is searched by the CP solver
+    Solution solve(const Solution &initial_solution);
+    void add_incumbent_listener(IncumbentListener listener);
+    void set_stop_token(std::stop_token stop_token);
+    // the workers continue from the better schedules other engines publish to this store
+    void set_incumbent_source(const IncumbentStore &incumbent_store);
+    // every worker selects its neighbourhoods with its own stream of the seed, make_seed(0) by default
+    void set_seed(uint64_t seed);
+
+    // a neighbourhood returns the indices of the jobs released from the incumbent, in precedence graph order
+    using Neighbourhood = std::vector<size_t> (LargeNeighbourhoodSearch::*)(
+        const std::vector<JobAllocation> &job_allocations, RandomGenerator &generator) const;
+    static const std::map<std::string, Neighbourhood, std::less<>> &get_neighbourhoods();
+
+  private:
+    // shared by the workers, the publisher forwards the improvements to the store and to the listeners
+    struct SearchState
+    {
+        SearchState(std::vector<IncumbentListener> listeners, std::chrono::steady_clock::time_point deadline,
+                    size_t makespan_lower_bound);
+
+        std::chrono::steady_clock::time_point deadline;
+        size_t makespan_lower_bound;
+        IncumbentStore incumbent_store;
+        std::mutex publisher_mutex;
+        IncumbentPublisher incumbent_publisher;
+        std::exception_ptr worker_exception;
+    };
+
+    std::vector<JobAllocation> find_initial_schedule(SearchState &search_state) const;
+    void run_worker(size_t worker_index, SearchState &search_state) const;
+    void publish(SearchState &search_state, const std::vector<JobAllocation> &job_allocations) const;
+    void import_incumbent(SearchState &search_state) const;
+    std::vector<JobAllocation> sort_by_job_index(const std::vector<JobAllocation> &job_allocations) const;
+    size_t get_neighbourhood_size() const;
+    std::vector<size_t> select_time_window(const std::vector<JobAllocation> &job_allocations,
+                                           RandomGenerator &generator) const;
+    std::vector<size_t> select_resource_critical_jobs(const std::vector<JobAllocation> &job_allocations,
+                                                      RandomGenerator &generator) const;
+    std::vector<size_t> select_precedence_block(const std::vector<JobAllocation> &job_allocations,
+                                                RandomGenerator &generator) const;
+    std::vector<size_t> select_random_jobs(const std::vector<JobAllocation> &job_allocations,
+                                           RandomGenerator &generator) const;
+
+    const ProblemInstance &problem_instance;
+    PrecedenceGraph precedence_graph;
+    std::vector<IncumbentListener> incumbent_listeners;
+    std::stop_token stop_token;
+    const IncumbentStore *incumbent_source = nullptr;
+    uint64_t random_seed = make_seed(0);
+};
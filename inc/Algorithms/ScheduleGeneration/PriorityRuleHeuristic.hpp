@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Algorithms/ScheduleGeneration/ScheduleDecoder.hpp"
+#include "ProblemInstance/PrecedenceGraph.hpp"
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Shared/Random.hpp"
+#include "Solution/Incumbent.hpp"
+#include "Solution/Solution.hpp"
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+// multi-pass priority rule heuristic: every pass builds an activity list from a priority rule and a mode assignment,
+// decodes it with the serial and the parallel SGS and the best schedule is kept
+class PriorityRuleHeuristic
+{
+  public:
+    explicit PriorityRuleHeuristic(const ProblemInstance &problem_instance);
+    PriorityRuleHeuristic(const PriorityRuleHeuristic &) = delete;
+    PriorityRuleHeuristic &operator=(const PriorityRuleHeuristic &) = delete;
+
+    Solution solve();
+    void add_incumbent_listener(IncumbentListener listener);
+    void set_stop_token(std::stop_token stop_token);
+    // PRIORITY_RULE_PASSES by default, the first pass of every rule is deterministic and the next ones are sampled
+    void set_nb_passes(size_t nb_passes);
+    // every sampled pass draws from its own stream of the seed, whichever thread runs it, make_seed(0) by default
+    void set_seed(uint64_t seed);
+
+    // a rule gives the larger values to the jobs to schedule first, computed with the shortest executable modes
+    using PriorityRule = std::vector<double> (PriorityRuleHeuristic::*)() const;
+    static const std::map<std::string, PriorityRule, std::less<>> &get_priority_rules();
+
+  private:
+    struct SearchState
+    {
+        SearchState(std::vector<IncumbentListener> listeners, size_t makespan_lower_bound,
+                    std::chrono::steady_clock::time_point deadline);
+
+        std::chrono::steady_clock::time_point deadline;
+        std::atomic<size_t> next_pass = 0;
+        SharedIncumbent shared_incumbent;
+        std::mutex exception_mutex;
+        std::exception_ptr worker_exception;
+    };
+
+    void run_passes(SearchState &search_state) const;
+    // the first pass of every rule follows the priorities and the shortest modes, the next ones sample them
+    void build_activity_list(const std::vector<double> &priorities, bool sampled, RandomGenerator &generator,
+                             std::vector<size_t> &activity_list) const;
+    void build_job_modes(bool sampled, RandomGenerator &generator, std::vector<size_t> &job_modes) const;
+
+    std::vector<double> compute_latest_finish_priorities() const;
+    std::vector<double> compute_latest_start_priorities() const;
+    std::vector<double> compute_most_total_successors_priorities() const;
+    std::vector<double> compute_greatest_rank_positional_weight_priorities() const;
+    std::vector<double> compute_minimum_slack_priorities() const;
+
+    const ProblemInstance &problem_instance;
+    PrecedenceGraph precedence_graph;
+    std::vector<std::vector<size_t>> executable_modes;
+    std::vector<size_t> shortest_modes;
+    std::vector<size_t> min_durations;
+    std::vector<size_t> heads;
+    std::vector<size_t> tails;
+    std::vector<std::vector<double>> rule_priorities;
+    size_t makespan_lower_bound = 0;
+    size_t nb_passes = 0;
+    std::vector<IncumbentListener> incumbent_listeners;
+    std::stop_token stop_token;
+    uint64_t random_seed = make_seed(0);
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+// usage of one resource over the time points [0, horizon), as a segment tree with range additions and
+// range maximum queries, so that the conflicts of a time window are found in logarithmic time
+class ResourceProfileTree
+{
+  public:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    explicit ResourceProfileTree(size_t horizon);
+
+    size_t get_horizon() const;
+    // adds units to every time point of [first, last)
+    void add(size_t first, size_t last, long long units);
+    long long get_max(size_t first, size_t last) const;
+    // first or last time point of [first, last) whose usage exceeds the threshold, npos when there is none
+    size_t find_first_above(size_t first, size_t last, long long threshold) const;
+    size_t find_last_above(size_t first, size_t last, long long threshold) const;
+
+  private:
+    void add(size_t node, size_t node_first, size_t node_last, size_t first, size_t last, long long units);
+    long long get_max(size_t node, size_t node_first, size_t node_last, size_t first, size_t last) const;
+    size_t find_above(size_t node, size_t node_first, size_t node_last, size_t first, size_t last,
+                      long long threshold, bool leftmost) const;
+
+    size_t horizon;
+    // the maximum of a node covers its subtree and includes the additions of the node itself, not its ancestors
+    std::vector<long long> max_usages;
+    std::vector<long long> added_units;
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "ProblemInstance/PrecedenceGraph.hpp"
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Shared/ResourceProfile.hpp"
+#include "Solution/Solution.hpp"
+#include <vector>
+
+// turns an activity list and a mode assignment into a schedule, jobs are identified by their precedence graph index
+// and modes by their 0-based index; the buffers are allocated once so decode() does not allocate
+class ScheduleDecoder
+{
+  public:
+    explicit ScheduleDecoder(const ProblemInstance &problem_instance);
+
+    // serial SGS: the jobs of a precedence feasible activity list start in turn at their earliest feasible time,
+    // returns the makespan
+    size_t decode(const std::vector<size_t> &activity_list, const std::vector<size_t> &job_modes);
+    // serial SGS which keeps the schedule of the last serial decode up to the first position whose job or mode
+    // changed, so that a move late in the activity list only pays for the suffix it changes
+    size_t redecode(const std::vector<size_t> &activity_list, const std::vector<size_t> &job_modes);
+    // parallel SGS: at every decision point the available jobs start in activity list order while they fit,
+    // the activity list only gives the priorities and does not need to be precedence feasible
+    size_t decode_parallel(const std::vector<size_t> &activity_list, const std::vector<size_t> &job_modes);
+
+    // schedule of the last decode
+    const std::vector<size_t> &get_start_times() const;
+    std::vector<JobAllocation> get_job_allocations(const std::vector<size_t> &job_modes) const;
+
+    const PrecedenceGraph &get_precedence_graph() const;
+    size_t get_nb_jobs() const;
+    size_t get_nb_resources() const;
+    size_t get_nb_modes(size_t job_index) const;
+    size_t get_duration(size_t job_index, size_t mode_index) const;
+    size_t get_demand(size_t job_index, size_t mode_index, size_t resource_index) const;
+    size_t get_capacity(size_t resource_index) const;
+    bool is_executable(size_t job_index, size_t mode_index) const;
+
+  private:
+    size_t decode_from(const std::vector<size_t> &activity_list, const std::vector<size_t> &job_modes,
+                       size_t first_position);
+    template <typename Profile>
+    size_t decode_from(Profile &typed_profile, const std::vector<size_t> &activity_list,
+                       const std::vector<size_t> &job_modes, size_t first_position);
+    bool fits(size_t mode_offset, size_t start_time) const;
+    void place(size_t job_index, size_t mode_offset, size_t start_time);
+    void unplace(size_t job_index, size_t mode_offset);
+
+    PrecedenceGraph precedence_graph;
+    size_t nb_jobs;
+    size_t nb_resources;
+    // no schedule of executable modes ends after the horizon
+    size_t horizon = 0;
+    std::vector<size_t> capacities;
+    std::vector<size_t> release_times;
+    // the predecessors of job j are predecessor_indices[predecessor_offsets[j]] to [predecessor_offsets[j + 1] - 1]
+    std::vector<size_t> predecessor_offsets;
+    std::vector<size_t> predecessor_indices;
+    std::vector<size_t> successor_offsets;
+    std::vector<size_t> successor_indices;
+    // mode m of job j is mode_offsets[j] + m in durations, and in demands once multiplied by the number of resources
+    std::vector<size_t> mode_offsets;
+    std::vector<size_t> durations;
+    std::vector<size_t> demands;
+
+    // rows of the profile are the mode offsets, only the first used_horizon time points may be non zero
+    AnyResourceProfile profile;
+    size_t used_horizon = 0;
+    std::vector<size_t> start_times;
+    std::vector<size_t> finish_times;
+    std::vector<size_t> nb_unscheduled_predecessors;
+    std::vector<size_t> earliest_starts;
+    std::vector<char> scheduled;
+
+    // last serial decode: its activity list and modes, and the makespan of every prefix of the activity list
+    bool serial_decoded = false;
+    std::vector<size_t> decoded_activity_list;
+    std::vector<size_t> decoded_job_modes;
+    std::vector<size_t> prefix_makespans;
+};
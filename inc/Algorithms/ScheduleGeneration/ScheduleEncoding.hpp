@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Algorithms/ScheduleGeneration/ScheduleDecoder.hpp"
+#include "Shared/Random.hpp"
+#include "Solution/Incumbent.hpp"
+#include <optional>
+#include <vector>
+
+// the standard MRCPSP encoding: a precedence feasible activity list and the 0-based mode of every job
+struct ScheduleEncoding
+{
+    std::vector<size_t> activity_list;
+    std::vector<size_t> job_modes;
+    // makespan of the serial SGS decoding
+    size_t makespan = 0;
+};
+
+// random topological order and random executable modes
+ScheduleEncoding make_random_encoding(const ScheduleDecoder &decoder, RandomGenerator &generator);
+
+// activity list by increasing start time, ties by topological order: its serial SGS decoding, left in the decoder,
+// starts no job later than the given schedule
+ScheduleEncoding make_encoding(ScheduleDecoder &decoder, const std::vector<JobAllocation> &job_allocations);
+
+// the encoding of the best schedule of the incumbent source when it beats the shared incumbent, which it then replaces
+std::optional<ScheduleEncoding> import_incumbent(ScheduleDecoder &decoder, const IncumbentStore *incumbent_source,
+                                                 SharedIncumbent &shared_incumbent);
+
+// replaces the modes exceeding a resource capacity by a random executable mode
+void repair_modes(const ScheduleDecoder &decoder, std::vector<size_t> &job_modes, RandomGenerator &generator);
+
+bool is_precedence_feasible(const PrecedenceGraph &precedence_graph, const std::vector<size_t> &activity_list);
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Solution/Solution.hpp"
+
+// forward-backward improvement: the jobs are alternately right-justified by decreasing finish time against the
+// makespan and left-justified by increasing start time, each one at its latest or earliest feasible time, until the
+// makespan stops decreasing. No job ever moves beyond a position it held, so the schedule stays feasible and the
+// makespan never grows. Returns true when the makespan of the solution was reduced.
+bool justify_schedule(const ProblemInstance &problem_instance, Solution &solution);
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Algorithms/ScheduleGeneration/ScheduleDecoder.hpp"
+#include "Algorithms/ScheduleGeneration/ScheduleEncoding.hpp"
+#include "Shared/Random.hpp"
+#include <utility>
+#include <vector>
+
+enum class ScheduleMoveType
+{
+    SHIFT,
+    SWAP,
+    MODE_CHANGE
+};
+
+// a shift moves the job at position first to position second, a swap exchanges the jobs at positions first and
+// second and a mode change gives mode second to job first, previous_mode being kept to undo it
+struct ScheduleMove
+{
+    ScheduleMoveType type = ScheduleMoveType::SHIFT;
+    size_t first = 0;
+    size_t second = 0;
+    size_t previous_mode = 0;
+};
+
+// an encoding changed in place by precedence feasible moves which can be undone
+class ScheduleNeighbourhood
+{
+  public:
+    ScheduleNeighbourhood(const ScheduleDecoder &decoder, ScheduleEncoding encoding);
+
+    const ScheduleEncoding &get_encoding() const;
+    // restarts from another encoding of the same instance
+    void set_encoding(ScheduleEncoding encoding);
+    void set_makespan(size_t makespan);
+    size_t get_position(size_t job_index) const;
+
+    // a move which changes the encoding, or a shift of a position onto itself when the encoding cannot change
+    ScheduleMove sample_move(RandomGenerator &generator) const;
+    void apply(const ScheduleMove &move);
+    void undo(const ScheduleMove &move);
+    // first position of the activity list whose job or mode the move changes
+    size_t get_first_changed_position(const ScheduleMove &move) const;
+
+  private:
+    // positions the job at position can be shifted to without breaking a precedence relation
+    std::pair<size_t, size_t> get_shift_window(size_t position) const;
+    bool sample_shift(RandomGenerator &generator, ScheduleMove &move) const;
+    bool sample_swap(RandomGenerator &generator, ScheduleMove &move) const;
+    bool sample_mode_change(RandomGenerator &generator, ScheduleMove &move) const;
+    void shift(size_t from_position, size_t to_position);
+
+    const PrecedenceGraph &precedence_graph;
+    std::vector<std::vector<size_t>> executable_modes;
+    std::vector<size_t> multi_mode_jobs;
+    ScheduleEncoding encoding;
+    std::vector<size_t> positions;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Algorithms/ScheduleGeneration/ScheduleDecoder.hpp"
+#include "Algorithms/ScheduleGeneration/ScheduleNeighbourhood.hpp"
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Shared/Random.hpp"
+#include "Solution/Incumbent.hpp"
+#include "Solution/Solution.hpp"
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <stop_token>
+#include <vector>
+
+// simulated annealing with parallel tempering: every thread anneals one replica over shift, swap and mode change
+// moves, and between two rounds the replicas at neighbouring temperatures may exchange their temperatures
+class SimulatedAnnealing
+{
+  public:
+    explicit SimulatedAnnealing(const ProblemInstance &problem_instance);
+    SimulatedAnnealing(const SimulatedAnnealing &) = delete;
+    SimulatedAnnealing &operator=(const SimulatedAnnealing &) = delete;
+
+    Solution solve();
+    void add_incumbent_listener(IncumbentListener listener);
+    void set_stop_token(std::stop_token stop_token);
+    // the better schedules other engines publish to this store replace the coldest replica between two rounds
+    void set_incumbent_source(const IncumbentStore &incumbent_store);
+    // every replica draws from its own stream of the seed, make_seed(0) by default
+    void set_seed(uint64_t seed);
+
+  private:
+    struct SearchState
+    {
+        SearchState(std::vector<IncumbentListener> listeners, size_t makespan_lower_bound, size_t nb_replicas,
+                    uint64_t seed, std::chrono::steady_clock::time_point start,
+                    std::chrono::steady_clock::time_point deadline);
+
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point deadline;
+        // written between two rounds only, while every replica waits on the barrier
+        std::vector<double> temperatures;
+        std::vector<size_t> replica_makespans;
+        // replica_at_rank[0] is the coldest replica
+        std::vector<size_t> replica_at_rank;
+        RandomGenerator exchange_generator;
+        size_t nb_rounds = 0;
+        size_t nb_exchanges = 0;
+        std::atomic<bool> stopped = false;
+        SharedIncumbent shared_incumbent;
+        std::mutex exception_mutex;
+        std::exception_ptr worker_exception;
+    };
+
+    struct RoundCompletion
+    {
+        void operator()() const noexcept;
+
+        const SimulatedAnnealing *simulated_annealing;
+        SearchState *search_state;
+    };
+
+    void run_replica(size_t replica_index, SearchState &search_state, std::barrier<RoundCompletion> &barrier) const;
+    // exchanges the temperatures of neighbouring replicas, then cools the ladder with the elapsed runtime
+    void end_round(SearchState &search_state) const noexcept;
+    // the coldest replica follows a geometric cooling from the initial to the final temperature over the runtime,
+    // the hottest one stays at the initial temperature and the others are spread geometrically in between
+    void update_temperatures(SearchState &search_state) const;
+    void publish(SearchState &search_state, const ScheduleDecoder &decoder, const ScheduleEncoding &encoding) const;
+
+    const ProblemInstance &problem_instance;
+    size_t makespan_lower_bound = 0;
+    std::vector<IncumbentListener> incumbent_listeners;
+    std::stop_token stop_token;
+    const IncumbentStore *incumbent_source = nullptr;
+    uint64_t random_seed = make_seed(0);
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Algorithms/ScheduleGeneration/ScheduleDecoder.hpp"
+#include "Algorithms/ScheduleGeneration/ScheduleNeighbourhood.hpp"
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Shared/Random.hpp"
+#include "Solution/Incumbent.hpp"
+#include "Solution/Solution.hpp"
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <unordered_map>
+#include <vector>
+
+// tabu search over shift, swap and mode change moves: at every iteration the workers sample and evaluate a share
+// of the candidate moves, and the best move which is not tabu, or which improves the best schedule, is applied
+class TabuSearch
+{
+  public:
+    explicit TabuSearch(const ProblemInstance &problem_instance);
+    TabuSearch(const TabuSearch &) = delete;
+    TabuSearch &operator=(const TabuSearch &) = delete;
+
+    Solution solve();
+    void add_incumbent_listener(IncumbentListener listener);
+    void set_stop_token(std::stop_token stop_token);
+    // the search restarts from the better schedules other engines publish to this store
+    void set_incumbent_source(const IncumbentStore &incumbent_store);
+    // every worker samples from its own stream of the seed, make_seed(0) by default
+    void set_seed(uint64_t seed);
+
+  private:
+    struct Candidate
+    {
+        ScheduleMove move;
+        size_t makespan;
+    };
+
+    struct SearchState
+    {
+        SearchState(std::vector<IncumbentListener> listeners, size_t makespan_lower_bound,
+                    const ProblemInstance &problem_instance, size_t nb_workers, uint64_t seed,
+                    std::chrono::steady_clock::time_point deadline);
+
+        std::chrono::steady_clock::time_point deadline;
+        // written between two iterations only, while every worker waits on the barrier
+        std::vector<std::vector<Candidate>> worker_candidates;
+        std::optional<ScheduleMove> selected_move;
+        // the current encoding was replaced by an imported schedule, the workers copy it instead of the move
+        bool restarted = false;
+        // iteration until which a move attribute is tabu, a list move forbids moving the job again and a mode
+        // change forbids giving back the previous mode
+        std::unordered_map<uint64_t, size_t> tabu_list;
+        size_t nb_iterations = 0;
+        RandomGenerator selection_generator;
+        // the current encoding, decoded again only to publish it
+        ScheduleDecoder decoder;
+        std::optional<ScheduleNeighbourhood> current;
+        std::atomic<bool> stopped = false;
+        SharedIncumbent shared_incumbent;
+        std::mutex exception_mutex;
+        std::exception_ptr worker_exception;
+    };
+
+    struct IterationCompletion
+    {
+        void operator()() const noexcept;
+
+        const TabuSearch *tabu_search;
+        SearchState *search_state;
+    };
+
+    void run_worker(size_t worker_index, SearchState &search_state, std::barrier<IterationCompletion> &barrier) const;
+    // the candidates are evaluated by decreasing first changed position, so that every decode only replaces the
+    // schedule from the first position its move changed
+    void evaluate_candidates(ScheduleNeighbourhood &neighbourhood, ScheduleDecoder &decoder, size_t nb_candidates,
+                             RandomGenerator &generator, std::vector<Candidate> &candidates) const;
+    void end_iteration(SearchState &search_state) const noexcept;
+    void select_move(SearchState &search_state) const;
+    // attributes of a move on the current encoding, or with reverse those which would undo it
+    static std::vector<uint64_t> get_attributes(const ScheduleNeighbourhood &neighbourhood, const ScheduleMove &move,
+                                                bool reverse);
+    void publish(SearchState &search_state) const;
+
+    const ProblemInstance &problem_instance;
+    size_t makespan_lower_bound = 0;
+    std::vector<IncumbentListener> incumbent_listeners;
+    std::stop_token stop_token;
+    const IncumbentStore *incumbent_source = nullptr;
+    uint64_t random_seed = make_seed(0);
+};
@@ -8,6 +8,7 @@ namespace Settings
     #define DEFAULT_FIRST_INSTANCE_INDEX     0
     #define DEFAULT_LAST_INSTANCE_INDEX      10
     #define DEFAULT_INSTANCE_NAME            "instance"
+    #define DEFAULT_RANDOM_SEED              0
 
     namespace Generator
     {
@@ -35,10 +36,57 @@ namespace Settings
         #define DEFAULT_USE_CPLEX         false
         #define DEFAULT_USE_CP            false
         #define DEFAULT_CHECK_SOLUTION    true
+        #define DEFAULT_JUSTIFY_SCHEDULE  true
         #define DEFAULT_DRAW_GANTT_CHART  false;
+        #define DEFAULT_WRITE_CONVERGENCE false
 
         #define DEFAULT_INIT_ILP_SOLUTION false
         #define DEFAULT_ILP_RELATIVE_GAP  0.0
+        #define DEFAULT_ILP_PRESOLVE      true
+        #define DEFAULT_ILP_FORMULATION   "pulse"
+        #define DEFAULT_ILP_MODEL_CACHE_DIRECTORY ""
+        #define DEFAULT_ILP_LAZY_RESOURCE_CONSTRAINTS false
+
+        #define DEFAULT_CP_WORKERS        0
+        #define DEFAULT_CP_SEARCH_TYPE    "Restart"
+        #define DEFAULT_CP_DETERMINISTIC_PARALLEL true
+        #define DEFAULT_CP_REDUNDANT_CUMULATIVE false
+        #define DEFAULT_CP_MAKESPAN_LOWER_BOUND false
+        #define DEFAULT_CP_TRANSITIVE_REDUCTION false
+        #define DEFAULT_CP_UNARY_NO_OVERLAP false
+        #define DEFAULT_CP_SEARCH_PHASE   "default"
+        #define DEFAULT_CP_MODE_PREFERENCE "default"
         #define DEFAULT_INIT_SOLUTION     false
+
+        #define DEFAULT_USE_LNS           false
+        #define DEFAULT_LNS_WORKERS       0
+        #define DEFAULT_LNS_NEIGHBOURHOOD_SIZE 200
+        #define DEFAULT_LNS_ITERATION_TIME_LIMIT 2.0
+
+        #define DEFAULT_USE_BRANCH_AND_BOUND false
+        #define DEFAULT_BRANCH_AND_BOUND_WORKERS 0
+        #define DEFAULT_BRANCH_AND_BOUND_CUTSET_LIMIT 1000000
+
+        #define DEFAULT_USE_PRIORITY_RULES false
+        #define DEFAULT_PRIORITY_RULE_PASSES 5000
+
+        #define DEFAULT_USE_GENETIC_ALGORITHM false
+        #define DEFAULT_GA_ISLANDS        0
+        #define DEFAULT_GA_POPULATION_SIZE 40
+        #define DEFAULT_GA_MUTATION_PROBABILITY 0.05
+        #define DEFAULT_GA_MIGRATION_INTERVAL 25
+
+        #define DEFAULT_USE_SIMULATED_ANNEALING false
+        #define DEFAULT_SA_REPLICAS       0
+        #define DEFAULT_SA_INITIAL_TEMPERATURE 0.05
+        #define DEFAULT_SA_FINAL_TEMPERATURE 0.001
+        #define DEFAULT_SA_ROUND_MOVES    1000
+
+        #define DEFAULT_USE_TABU_SEARCH   false
+        #define DEFAULT_TABU_SEARCH_WORKERS 0
+        #define DEFAULT_TABU_SEARCH_CANDIDATES 64
+        #define DEFAULT_TABU_SEARCH_TENURE 10
+        #define DEFAULT_USE_PORTFOLIO     false
+        #define DEFAULT_PORTFOLIO_BACKENDS ""
     } // namespace SolverSettings
 } // namespace Settings
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "ILPSolverModel.hpp"
+#include <limits>
+#include <utility>
+#include <vector>
+
+class ILPPresolver
+{
+  public:
+    ILPPresolver() = default;
+    ILPPresolver(const ILPPresolver &) = delete;
+    ILPPresolver &operator=(const ILPPresolver &) = delete;
+
+    static constexpr size_t REMOVED = std::numeric_limits<size_t>::max();
+
+    void fix_variable(size_t index, double value);
+    void presolve(ILPSolverModel &ilp_model);
+    std::vector<double> postsolve(const std::vector<double> &reduced_solution) const;
+    size_t get_reduced_index(size_t original_index) const;
+    // maps a row of the original model to the reduced one, the fixed variables are moved to the right-hand side
+    void reduce_row(SparseMatrix<double>::Row &row, double &b) const;
+    double get_fixed_value(size_t original_index) const;
+    bool is_active() const;
+    void log_statistics() const;
+
+  private:
+    bool fix_equal_bounds(ILPSolverModel &ilp_model);
+    bool substitute_fixed_variables(ILPSolverModel &ilp_model);
+    bool apply_singleton_rows(ILPSolverModel &ilp_model);
+    void tighten_coefficients(ILPSolverModel &ilp_model);
+    void fix_empty_columns(ILPSolverModel &ilp_model);
+    void remove_fixed_columns(ILPSolverModel &ilp_model);
+    bool is_removable(const ILPSolverModel &ilp_model, size_t index) const;
+    bool tighten_bound(DecisionVariable &variable, Operator op, double bound) const;
+
+    std::vector<std::pair<size_t, double>> requested_fixings;
+    std::vector<bool> fixed;
+    std::vector<double> fixed_values;
+    std::vector<size_t> reduced_index;
+    std::vector<size_t> original_index;
+    std::vector<bool> removed_rows;
+    size_t nb_original_variables = 0;
+    size_t nb_original_constraints = 0;
+    size_t nb_tightened_coefficients = 0;
+};
@@ -8,7 +8,9 @@
 #include "ILPSolverModel.hpp"
 #include "Shared/Constants.hpp"
 #include "Solution/Solution.hpp"
+#include <functional>
 #include <iostream>
+#include <stop_token>
 #include <string>
 #include <vector>
 
@@ -21,19 +23,43 @@ struct SolutionILP
     MODEL_STATUS status;
 };
 
+struct LazyConstraint
+{
+    SparseMatrix<double>::Row row;
+    Operator op;
+    double b;
+};
+
+// called with every new integer solution, returns the constraints violated by this solution
+using LazyConstraintGenerator = std::function<std::vector<LazyConstraint>(const std::vector<double> &solution)>;
+// called with every new incumbent accepted by the solver, together with its objective value and the best bound
+using IncumbentCallback = std::function<void(const std::vector<double> &solution, double objective, double bound)>;
+
 struct Solver
 {
-    virtual void initialize_local_environments(size_t nb_threads) const = 0;
     virtual std::string get_solver_identification() const = 0;
-    virtual SolutionILP solve_ilp(Solution &init_solution, const ILPSolverModel &ilp_model, bool verbose, double gap,
-                                  double time_limit, size_t nb_threads, size_t thread_id) const = 0;
+    // the start values give a MIP start, one value per variable of the model and NaN for the unknown ones,
+    // no start is given when they are empty
+    virtual SolutionILP solve_ilp(const std::vector<double> &start_values, const ILPSolverModel &ilp_model,
+                                  bool verbose, double gap, double time_limit, size_t nb_threads) const = 0;
+    void set_lazy_constraint_generator(LazyConstraintGenerator generator)
+    {
+        lazy_constraint_generator = std::move(generator);
+    }
+    void set_incumbent_callback(IncumbentCallback callback) { incumbent_callback = std::move(callback); }
+    // a stop request interrupts the optimization like the time limit
+    void set_stop_token(std::stop_token token) { stop_token = std::move(token); }
     virtual ~Solver() = default;
+
+  protected:
+    LazyConstraintGenerator lazy_constraint_generator;
+    IncumbentCallback incumbent_callback;
+    std::stop_token stop_token;
 };
 
 struct GurobiSolver : public Solver
 {
-    void initialize_local_environments(size_t nb_threads) const override;
     std::string get_solver_identification() const override;
-    SolutionILP solve_ilp(Solution &init_solution, const ILPSolverModel &ilp_model, bool verbose, double gap = 0.0,
-                          double time_limit = 0.0, size_t nb_threads = 1, size_t thread_id = 0) const override;
+    SolutionILP solve_ilp(const std::vector<double> &start_values, const ILPSolverModel &ilp_model, bool verbose,
+                          double gap = 0.0, double time_limit = 0.0, size_t nb_threads = 1) const override;
 };
@@ -49,6 +49,13 @@ struct ILPSolverModel
     void check_ilp_formulation() const;
     void log_statistics() const;
 
+    // files ending with ".gz" are compressed, the reader accepts both
+    void write_mps(const std::string &file_name) const;
+    void write_lp(const std::string &file_name) const;
+    void read_mps(const std::string &file_name);
+
+    // the NAME of the MPS files
+    std::string name = "MRCPSP";
     ObjectiveFunction obj;
     SparseMatrix<double> matrix_A;
     std::vector<double> vector_c;
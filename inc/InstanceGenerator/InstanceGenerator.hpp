@@ -1,6 +1,8 @@
 #pragma once
 
 #include "External/pempek_assert.hpp"
+#include "Shared/Random.hpp"
+#include <cstdint>
 #include <fstream>
 #include <map>
 #include <vector>
@@ -8,7 +10,8 @@
 class InstanceGenerator
 {
   public:
-    explicit InstanceGenerator(const std::string &file_name) : out_file(file_name)
+    // the same seed generates the same instance
+    InstanceGenerator(const std::string &file_name, uint64_t seed) : out_file(file_name), generator(seed)
     {
         PPK_ASSERT_ERROR(out_file.is_open(), "Failed to open the file %s", file_name.c_str());
     }
@@ -22,10 +25,11 @@ class InstanceGenerator
     using Dependencies = std::map<size_t, std::vector<size_t>>;
 
   private:
-    ResourceUnits generate_resource_units() const;
-    JobModes generate_job_modes(const InstanceGenerator::ResourceUnits &resouce_units) const;
-    ProcessingTimes generate_processing_times(const InstanceGenerator::JobModes &job_modes) const;
-    Dependencies generate_dependencies() const;
+    ResourceUnits generate_resource_units();
+    JobModes generate_job_modes(const InstanceGenerator::ResourceUnits &resouce_units);
+    ProcessingTimes generate_processing_times(const InstanceGenerator::JobModes &job_modes);
+    Dependencies generate_dependencies();
     void generated_data_to_json_file();
     std::ofstream out_file;
+    RandomGenerator generator;
 };
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Shared/Utils.hpp"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class PrecedenceGraph
+{
+  public:
+    explicit PrecedenceGraph(const ProblemInstance &problem_instance);
+    PrecedenceGraph(const PrecedenceGraph &) = delete;
+    PrecedenceGraph &operator=(const PrecedenceGraph &) = delete;
+
+    size_t get_nb_jobs() const;
+    size_t get_job_index(const std::string &job_id) const;
+    const JobConstPtr &get_job(size_t job_index) const;
+    const std::vector<size_t> &get_successors(size_t job_index) const;
+    const std::vector<size_t> &get_predecessors(size_t job_index) const;
+    const std::vector<size_t> &get_topological_order() const;
+    size_t get_min_processing_time(size_t job_index) const;
+
+    size_t get_release_time(size_t job_index) const;
+
+    // earliest start times when every job runs in its shortest mode
+    std::vector<size_t> compute_heads() const;
+    std::vector<size_t> compute_heads(const std::vector<size_t> &job_release_times) const;
+    // longest path from the start of a job to the end of the project, shortest modes, including the job itself
+    std::vector<size_t> compute_tails() const;
+    size_t compute_critical_path_length() const;
+    size_t compute_critical_path_length(const std::vector<size_t> &job_release_times) const;
+    // successors of every job without the arcs implied by longer paths
+    std::vector<std::vector<size_t>> compute_transitive_reduction() const;
+
+  private:
+    void compute_topological_order();
+
+    std::vector<JobConstPtr> jobs;
+    std::unordered_map<std::string, size_t, StringHash, std::equal_to<>> job_indices;
+    std::vector<std::vector<size_t>> successors;
+    std::vector<std::vector<size_t>> predecessors;
+    std::vector<size_t> topological_order;
+    std::vector<size_t> min_processing_times;
+    std::vector<size_t> release_times;
+};
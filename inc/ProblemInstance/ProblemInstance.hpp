@@ -2,6 +2,7 @@
 
 #include "Job.hpp"
 #include "Shared/Queue.hpp"
+#include <cstdint>
 
 class ProblemInstance
 {
@@ -11,6 +12,11 @@ class ProblemInstance
     ProblemInstance &operator=(const ProblemInstance &) = delete;
 
     void set_makespan_upperbound();
+    // largest resource energy divided by the resource capacity, every job in its least consuming mode
+    size_t compute_energy_lower_bound() const;
+    // hash of everything a model of the instance is built from, two instances with the same fingerprint are the same
+    // up to their names
+    uint64_t compute_fingerprint() const;
     void append_job(const JobPtr &job);
     JobConstPtr find_job(const std::string &job_id) const;
     const std::vector<Resource> &get_resources() const;
@@ -36,4 +42,6 @@ class ProblemInstance
     friend class VariableModelBuilder;
     friend class TimeIndexedModelVariableMapping;
     friend class CPSolver;
+    friend class PrecedenceGraph;
+    friend class ProblemSolverILP;
 };
@@ -10,6 +10,8 @@ namespace Settings
     extern size_t FIRST_INSTANCE_INDEX;
     extern size_t LAST_INSTANCE_INDEX;
     extern std::string INSTANCE_NAME;
+    // the seed of the generators and the randomised searches, 0 draws a different one on every run
+    extern size_t RANDOM_SEED;
 
     namespace Generator
     {
@@ -37,10 +39,59 @@ namespace Settings
         extern bool USE_CPLEX;
         extern bool USE_CP;
         extern bool CHECK_SOLUTION;
+        extern bool JUSTIFY_SCHEDULE;
         extern bool DRAW_GANTT_CHART;
+        extern bool WRITE_CONVERGENCE;
 
         extern bool INIT_ILP_SOLUTION;
         extern double ILP_RELATIVE_GAP;
+        extern bool ILP_PRESOLVE;
+        extern std::string ILP_FORMULATION;
+        extern std::string ILP_MODEL_CACHE_DIRECTORY;
+        extern bool ILP_LAZY_RESOURCE_CONSTRAINTS;
+
+        // 0 uses NB_THREADS workers
+        extern size_t CP_WORKERS;
+        extern std::string CP_SEARCH_TYPE;
+        extern bool CP_DETERMINISTIC_PARALLEL;
+        extern bool CP_REDUNDANT_CUMULATIVE;
+        extern bool CP_MAKESPAN_LOWER_BOUND;
+        extern bool CP_TRANSITIVE_REDUCTION;
+        extern bool CP_UNARY_NO_OVERLAP;
+        extern std::string CP_SEARCH_PHASE;
+        extern std::string CP_MODE_PREFERENCE;
         extern bool INIT_SOLUTION;
+
+        extern bool USE_LNS;
+        extern size_t LNS_WORKERS;
+        extern size_t LNS_NEIGHBOURHOOD_SIZE;
+        extern double LNS_ITERATION_TIME_LIMIT;
+
+        extern bool USE_BRANCH_AND_BOUND;
+        extern size_t BRANCH_AND_BOUND_WORKERS;
+        extern size_t BRANCH_AND_BOUND_CUTSET_LIMIT;
+
+        extern bool USE_PRIORITY_RULES;
+        extern size_t PRIORITY_RULE_PASSES;
+
+        extern bool USE_GENETIC_ALGORITHM;
+        extern size_t GA_ISLANDS;
+        extern size_t GA_POPULATION_SIZE;
+        extern double GA_MUTATION_PROBABILITY;
+        extern size_t GA_MIGRATION_INTERVAL;
+
+        extern bool USE_SIMULATED_ANNEALING;
+        extern size_t SA_REPLICAS;
+        extern double SA_INITIAL_TEMPERATURE;
+        extern double SA_FINAL_TEMPERATURE;
+        extern size_t SA_ROUND_MOVES;
+
+        extern bool USE_TABU_SEARCH;
+        extern size_t TABU_SEARCH_WORKERS;
+        extern size_t TABU_SEARCH_CANDIDATES;
+        extern size_t TABU_SEARCH_TENURE;
+        extern bool USE_PORTFOLIO;
+        // comma separated backend names, every available backend when empty
+        extern std::string PORTFOLIO_BACKENDS;
     } // namespace Solver
 } // namespace Settings
\ No newline at end of file
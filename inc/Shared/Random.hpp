@@ -0,0 +1,85 @@
+#pragma once
+
+#include "External/pempek_assert.hpp"
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+// xoshiro256++ generator, every thread of a parallel search owns one stream of the run seed
+class RandomGenerator
+{
+  public:
+    using result_type = uint64_t;
+
+    // the streams of a seed start from unrelated states
+    explicit RandomGenerator(uint64_t seed, uint64_t stream = 0);
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+    result_type operator()();
+
+    // uniform in [0, bound) without modulo bias, the division is only needed on rare rejections
+    size_t uniform_index(size_t bound);
+    // uniform in [min_value, max_value]
+    template <std::integral T> T uniform_int(T min_value, T max_value);
+    // uniform in [0, 1)
+    double uniform_real();
+    bool bernoulli(double probability);
+    // index i with a probability proportional to cumulative_weights[i] - cumulative_weights[i - 1], found by a binary
+    // search of one uniform draw in the non-decreasing running sums
+    size_t weighted_index(const std::vector<double> &cumulative_weights);
+
+  private:
+    std::array<uint64_t, 4> state;
+};
+
+// splitmix64 finaliser, spreads consecutive values over the whole range
+uint64_t mix_seed(uint64_t value);
+// the seed of one run: RANDOM_SEED mixed with the index, drawn from the system when RANDOM_SEED is 0
+uint64_t make_seed(uint64_t index);
+
+inline RandomGenerator::result_type RandomGenerator::operator()()
+{
+    const uint64_t result = std::rotl(state[0] + state[3], 23) + state[0];
+    const uint64_t shifted = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= shifted;
+    state[3] = std::rotl(state[3], 45);
+    return result;
+}
+
+inline size_t RandomGenerator::uniform_index(size_t bound)
+{
+    PPK_ASSERT_ERROR(bound > 0, "Cannot draw from an empty range");
+    // the high word of a 128 bit product, the low words below the threshold are rejected
+    unsigned __int128 product = static_cast<unsigned __int128>((*this)()) * bound;
+    if (static_cast<uint64_t>(product) < bound)
+    {
+        const uint64_t threshold = (0 - static_cast<uint64_t>(bound)) % bound;
+        while (static_cast<uint64_t>(product) < threshold)
+        {
+            product = static_cast<unsigned __int128>((*this)()) * bound;
+        }
+    }
+    return static_cast<size_t>(product >> 64);
+}
+
+template <std::integral T> T RandomGenerator::uniform_int(T min_value, T max_value)
+{
+    PPK_ASSERT_ERROR(min_value <= max_value, "Invalid random range");
+    using Unsigned = std::make_unsigned_t<T>;
+    const uint64_t range = static_cast<Unsigned>(static_cast<Unsigned>(max_value) - static_cast<Unsigned>(min_value));
+    const uint64_t offset = range == std::numeric_limits<uint64_t>::max() ? (*this)() : uniform_index(range + 1);
+    return static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(min_value) + offset));
+}
+
+inline double RandomGenerator::uniform_real() { return static_cast<double>((*this)() >> 11) * 0x1.0p-53; }
+
+inline bool RandomGenerator::bernoulli(double probability) { return uniform_real() < probability; }
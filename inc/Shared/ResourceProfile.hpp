@@ -0,0 +1,234 @@
+#pragma once
+
+#include "External/pempek_assert.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <variant>
+#include <vector>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// arithmetic on whole SSE2 vectors of units, the units without a specialisation are processed one by one
+template <typename Unit> struct UnitVector
+{
+    static constexpr bool vectorised = false;
+};
+
+#if defined(__SSE2__)
+template <> struct UnitVector<int8_t>
+{
+    static constexpr bool vectorised = true;
+    static __m128i greater(__m128i lhs, __m128i rhs) { return _mm_cmpgt_epi8(lhs, rhs); }
+    static __m128i add(__m128i lhs, __m128i rhs) { return _mm_add_epi8(lhs, rhs); }
+    static __m128i subtract(__m128i lhs, __m128i rhs) { return _mm_sub_epi8(lhs, rhs); }
+};
+
+template <> struct UnitVector<int16_t>
+{
+    static constexpr bool vectorised = true;
+    static __m128i greater(__m128i lhs, __m128i rhs) { return _mm_cmpgt_epi16(lhs, rhs); }
+    static __m128i add(__m128i lhs, __m128i rhs) { return _mm_add_epi16(lhs, rhs); }
+    static __m128i subtract(__m128i lhs, __m128i rhs) { return _mm_sub_epi16(lhs, rhs); }
+};
+
+template <> struct UnitVector<int32_t>
+{
+    static constexpr bool vectorised = true;
+    static __m128i greater(__m128i lhs, __m128i rhs) { return _mm_cmpgt_epi32(lhs, rhs); }
+    static __m128i add(__m128i lhs, __m128i rhs) { return _mm_add_epi32(lhs, rhs); }
+    static __m128i subtract(__m128i lhs, __m128i rhs) { return _mm_sub_epi32(lhs, rhs); }
+};
+#endif
+
+// usage of all the resources over the time points [0, horizon), stored time-major with the resources of a time
+// point padded to a whole vector: whether a demand row fits at a time point is one comparison per vector, 16
+// resources at once when every capacity fits in 8 bit units
+template <typename Unit> class ResourceProfile
+{
+  public:
+    // the demands of a row may exceed a capacity, such a row never fits
+    static constexpr size_t max_capacity = static_cast<size_t>(std::numeric_limits<Unit>::max()) - 1;
+    static constexpr size_t vector_size = 16 / sizeof(Unit);
+
+    ResourceProfile() = default;
+    // demands holds one row of capacities.size() units per mode, row k starts at demands[k * capacities.size()]
+    ResourceProfile(const std::vector<size_t> &capacities, const std::vector<size_t> &demands, size_t horizon);
+
+    size_t get_horizon() const { return horizon; }
+    // resets the usages of [0, last)
+    void clear(size_t last);
+    bool exceeds(size_t row, size_t time) const;
+    bool fits(size_t row, size_t first, size_t last) const;
+    // first start time from earliest_start on at which the row fits during duration time points
+    size_t find_earliest_start(size_t row, size_t duration, size_t earliest_start) const;
+    // the row must fit over [first, last), so that the usages never exceed the capacities
+    void add(size_t row, size_t first, size_t last);
+    void remove(size_t row, size_t first, size_t last);
+
+  private:
+    template <bool adding> void update(size_t row, size_t first, size_t last);
+
+    size_t horizon = 0;
+    size_t row_size = 0;
+    // a row fits at time t while every usage is at most its threshold, the padding demands nothing and always fits
+    std::vector<Unit> demands;
+    std::vector<Unit> thresholds;
+    // usages[t * row_size + r] of resource r at time t
+    std::vector<Unit> usages;
+};
+
+using AnyResourceProfile = std::variant<ResourceProfile<int8_t>, ResourceProfile<int16_t>, ResourceProfile<int32_t>,
+                                        ResourceProfile<int64_t>>;
+
+// the profile of the narrowest units holding every capacity
+inline AnyResourceProfile make_resource_profile(const std::vector<size_t> &capacities,
+                                                const std::vector<size_t> &demands, size_t horizon)
+{
+    const size_t max_capacity = capacities.empty() ? 0 : std::ranges::max(capacities);
+    if (max_capacity <= ResourceProfile<int8_t>::max_capacity)
+    {
+        return ResourceProfile<int8_t>(capacities, demands, horizon);
+    }
+    if (max_capacity <= ResourceProfile<int16_t>::max_capacity)
+    {
+        return ResourceProfile<int16_t>(capacities, demands, horizon);
+    }
+    if (max_capacity <= ResourceProfile<int32_t>::max_capacity)
+    {
+        return ResourceProfile<int32_t>(capacities, demands, horizon);
+    }
+    return ResourceProfile<int64_t>(capacities, demands, horizon);
+}
+
+template <typename Unit>
+ResourceProfile<Unit>::ResourceProfile(const std::vector<size_t> &capacities, const std::vector<size_t> &demands,
+                                       size_t horizon)
+    : horizon(horizon), row_size((capacities.size() + vector_size - 1) / vector_size * vector_size)
+{
+    const size_t nb_resources = capacities.size();
+    PPK_ASSERT_ERROR(nb_resources == 0 || demands.size() % nb_resources == 0,
+                     "every row must demand every resource");
+    const size_t nb_rows = nb_resources == 0 ? 0 : demands.size() / nb_resources;
+    this->demands.assign(nb_rows * row_size, 0);
+    thresholds.assign(nb_rows * row_size, std::numeric_limits<Unit>::max());
+    for (size_t r = 0; r < nb_resources; ++r)
+    {
+        PPK_ASSERT_ERROR(capacities[r] <= max_capacity, "the capacity of resource %zu is too large", r);
+    }
+    for (size_t row = 0; row < nb_rows; ++row)
+    {
+        for (size_t r = 0; r < nb_resources; ++r)
+        {
+            // a demand above the capacity has a negative threshold, which even an empty profile exceeds
+            const auto demand = static_cast<Unit>(std::min(demands[row * nb_resources + r], capacities[r] + 1));
+            this->demands[row * row_size + r] = demand;
+            thresholds[row * row_size + r] = static_cast<Unit>(static_cast<Unit>(capacities[r]) - demand);
+        }
+    }
+    usages.assign(horizon * row_size, 0);
+}
+
+template <typename Unit> void ResourceProfile<Unit>::clear(size_t last)
+{
+    PPK_ASSERT_ERROR(last <= horizon, "the time point %zu exceeds the horizon %zu", last, horizon);
+    std::fill_n(usages.begin(), last * row_size, 0);
+}
+
+template <typename Unit> bool ResourceProfile<Unit>::exceeds(size_t row, size_t time) const
+{
+    const Unit *usages_at_t = usages.data() + time * row_size;
+    const Unit *row_thresholds = thresholds.data() + row * row_size;
+#if defined(__SSE2__)
+    if constexpr (UnitVector<Unit>::vectorised)
+    {
+        __m128i conflicts = _mm_setzero_si128();
+        for (size_t r = 0; r < row_size; r += vector_size)
+        {
+            const __m128i usage = _mm_loadu_si128(reinterpret_cast<const __m128i *>(usages_at_t + r));
+            const __m128i threshold = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row_thresholds + r));
+            conflicts = _mm_or_si128(conflicts, UnitVector<Unit>::greater(usage, threshold));
+        }
+        return _mm_movemask_epi8(conflicts) != 0;
+    }
+#endif
+    bool conflict = false;
+    for (size_t r = 0; r < row_size; ++r)
+    {
+        conflict |= usages_at_t[r] > row_thresholds[r];
+    }
+    return conflict;
+}
+
+template <typename Unit> bool ResourceProfile<Unit>::fits(size_t row, size_t first, size_t last) const
+{
+    PPK_ASSERT_ERROR(last <= horizon, "the time window [%zu, %zu) exceeds the horizon %zu", first, last, horizon);
+    for (size_t t = first; t < last; ++t)
+    {
+        if (exceeds(row, t))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Unit>
+size_t ResourceProfile<Unit>::find_earliest_start(size_t row, size_t duration, size_t earliest_start) const
+{
+    // the window is scanned backwards so that the latest conflict at time t moves the start directly to t + 1
+    size_t start_time = earliest_start;
+    PPK_ASSERT_ERROR(start_time + duration <= horizon, "the earliest start time %zu exceeds the horizon", start_time);
+    for (size_t t = start_time + duration; t > start_time;)
+    {
+        --t;
+        if (exceeds(row, t))
+        {
+            start_time = t + 1;
+            t = start_time + duration;
+            PPK_ASSERT_ERROR(t <= horizon, "a mode exceeding a resource capacity was selected");
+        }
+    }
+    return start_time;
+}
+
+template <typename Unit> void ResourceProfile<Unit>::add(size_t row, size_t first, size_t last)
+{
+    update<true>(row, first, last);
+}
+
+template <typename Unit> void ResourceProfile<Unit>::remove(size_t row, size_t first, size_t last)
+{
+    update<false>(row, first, last);
+}
+
+template <typename Unit>
+template <bool adding>
+void ResourceProfile<Unit>::update(size_t row, size_t first, size_t last)
+{
+    const Unit *row_demands = demands.data() + row * row_size;
+    for (size_t t = first; t < last; ++t)
+    {
+        Unit *usages_at_t = usages.data() + t * row_size;
+#if defined(__SSE2__)
+        if constexpr (UnitVector<Unit>::vectorised)
+        {
+            for (size_t r = 0; r < row_size; r += vector_size)
+            {
+                auto *usage_address = reinterpret_cast<__m128i *>(usages_at_t + r);
+                const __m128i usage = _mm_loadu_si128(usage_address);
+                const __m128i demand = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row_demands + r));
+                _mm_storeu_si128(usage_address, adding ? UnitVector<Unit>::add(usage, demand)
+                                                       : UnitVector<Unit>::subtract(usage, demand));
+            }
+            continue;
+        }
+#endif
+        for (size_t r = 0; r < row_size; ++r)
+        {
+            usages_at_t[r] = static_cast<Unit>(adding ? usages_at_t[r] + row_demands[r]
+                                                      : usages_at_t[r] - row_demands[r]);
+        }
+    }
+}
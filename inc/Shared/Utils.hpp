@@ -6,7 +6,6 @@
 #include <format>
 #include <iterator>
 #include <list>
-#include <random>
 #include <rapidjson/document.h>
 #include <source_location>
 #include <span>
@@ -29,14 +28,6 @@ template <typename CharT = char> std::basic_string<CharT> source_location_to_str
     }
 }
 
-template <typename T> T random_range(T min, T max)
-{
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    std::uniform_int_distribution<T> distrib(min, max);
-    return distrib(gen);
-}
-
 template <class Container>
 typename Container::mapped_type get_value(const Container &container, const typename Container::key_type &key,
                                           const std::source_location &loc)
@@ -86,6 +77,7 @@ struct StringHash
     using is_transparent = void;
     std::size_t operator()(const std::string &key) const noexcept { return std::hash<std::string>{}(key); }
     std::size_t operator()(const char *key) const noexcept { return std::hash<std::string>{}(key); }
+    std::size_t operator()(std::string_view key) const noexcept { return std::hash<std::string_view>{}(key); }
 };
 
 struct NumericalStringComparator
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Solution/Solution.hpp"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+struct Incumbent
+{
+    // seconds elapsed since the solver started, or since the store was created once an IncumbentStore keeps it
+    double timestamp = 0.0;
+    size_t makespan = 0;
+    double bound = -1;
+    std::vector<JobAllocation> job_allocations;
+};
+
+struct ConvergencePoint
+{
+    double timestamp;
+    size_t makespan;
+    double bound;
+};
+
+// listeners are called from the solver thread while the search continues, they must return quickly
+using IncumbentListener = std::function<void(const Incumbent &incumbent)>;
+
+// forwards the improving solutions of one solver run to the registered listeners
+class IncumbentPublisher
+{
+  public:
+    explicit IncumbentPublisher(std::vector<IncumbentListener> listeners);
+
+    bool has_listeners() const;
+    bool improves(size_t makespan) const;
+    void publish(size_t makespan, double bound, const std::vector<JobAllocation> &job_allocations);
+
+  private:
+    std::vector<IncumbentListener> listeners;
+    std::chrono::steady_clock::time_point start_time;
+    size_t best_makespan = std::numeric_limits<size_t>::max();
+};
+
+// keeps the best incumbent and the convergence curve, may be shared by solvers running in parallel; the store stamps
+// the incumbents it accepts with its own clock so that the curve does not mix the clocks of the solvers
+class IncumbentStore
+{
+  public:
+    IncumbentStore();
+    IncumbentStore(const IncumbentStore &) = delete;
+    IncumbentStore &operator=(const IncumbentStore &) = delete;
+
+    IncumbentListener get_listener();
+    bool offer(const Incumbent &incumbent);
+    std::optional<Incumbent> get_best() const;
+    size_t get_best_makespan() const;
+    std::vector<ConvergencePoint> get_convergence() const;
+
+  private:
+    mutable std::mutex mutex;
+    std::chrono::steady_clock::time_point start_time;
+    std::optional<Incumbent> best;
+    std::vector<ConvergencePoint> convergence;
+    std::atomic<size_t> best_makespan = std::numeric_limits<size_t>::max();
+};
+
+// the best schedule the threads of one solver run share: it is replaced and published under one lock, its makespan
+// can be read without it
+class SharedIncumbent
+{
+  public:
+    SharedIncumbent(std::vector<IncumbentListener> listeners, size_t makespan_lower_bound);
+
+    size_t get_best_makespan() const;
+    bool reached_lower_bound() const;
+    // keeps and publishes the schedule when it beats the best one
+    void offer(size_t makespan, std::vector<JobAllocation> job_allocations);
+    // the best incumbent of the source when it beats the best schedule
+    std::optional<Incumbent> get_import(const IncumbentStore *incumbent_source) const;
+    // keeps the decoding of an import when it beats the best schedule, it is only published again when the decoding
+    // shortened the imported schedule
+    void offer_import(size_t makespan, size_t imported_makespan, std::vector<JobAllocation> job_allocations);
+    // state, makespan, bound and gap of the best schedule, whose job allocations are moved to the solution
+    void complete_solution(Solution &solution);
+
+  private:
+    void replace(size_t makespan, std::vector<JobAllocation> job_allocations, bool published);
+
+    size_t makespan_lower_bound;
+    std::mutex mutex;
+    std::atomic<size_t> best_makespan = std::numeric_limits<size_t>::max();
+    IncumbentPublisher publisher;
+    std::vector<JobAllocation> best_job_allocations;
+};
+
+IncumbentListener make_incumbent_logger(const std::string &solver_name);
+
+void write_convergence_to_json(const std::vector<ConvergencePoint> &convergence, const std::string &file_name);
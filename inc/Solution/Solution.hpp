@@ -53,6 +53,7 @@ struct Solution
     size_t makespan = 0;
     double runtime = 0.0;
     double mem_usage = 0.0;
+    std::string solver_configuration;
     std::vector<JobAllocation> job_allocations;
     void inverse_allocated_resource_units(const ProblemInstance &problem_instance);
     std::string get_solution_as_string() const;
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Solution/Incumbent.hpp"
+#include "Solution/Solution.hpp"
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// what a backend run shares with its caller, a portfolio gives the same store to all its engines
+struct SolverContext
+{
+    IncumbentStore &incumbent_store;
+    // a stop request ends the run early, the engine returns its best solution so far
+    std::stop_token stop_token;
+    // called with every incumbent of the engine, in addition to the store
+    std::vector<IncumbentListener> incumbent_listeners;
+    // the randomised engines derive the streams of their threads from it
+    uint64_t seed = 0;
+};
+
+// a solver engine compiled into this build, the commercial backends are only registered when their library was found
+struct SolverBackend
+{
+    std::string name;
+    std::function<Solution(const ProblemInstance &problem_instance, const SolverContext &context)> solve;
+};
+
+class SolverBackendRegistry
+{
+  public:
+    static void register_backend(SolverBackend backend);
+    static bool is_available(std::string_view name);
+    static const SolverBackend &get_backend(std::string_view name);
+    static std::vector<std::string> get_available_backend_names();
+    static std::string get_available_backends_as_string();
+
+  private:
+    static std::map<std::string, SolverBackend, std::less<>> &get_backends();
+};
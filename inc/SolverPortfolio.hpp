@@ -0,0 +1,52 @@
+#pragma once
+
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Solution/Solution.hpp"
+#include "SolverBackends.hpp"
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// races several backends on their own threads: they publish to the same incumbent store, the engines which support
+// it continue from the better schedules of the others, and all of them stop once the best schedule reaches the best
+// lower bound reported by any of them
+class SolverPortfolio
+{
+  public:
+    SolverPortfolio(const ProblemInstance &problem_instance, std::vector<std::string> backend_names);
+    SolverPortfolio(const SolverPortfolio &) = delete;
+    SolverPortfolio &operator=(const SolverPortfolio &) = delete;
+
+    Solution solve(const SolverContext &context) const;
+
+    // the backends of a comma separated list, every available backend except the portfolio itself when empty
+    static std::vector<std::string> parse_backend_names(std::string_view backend_names);
+
+  private:
+    struct RaceState
+    {
+        explicit RaceState(double lower_bound);
+
+        std::stop_source stop_source;
+        std::mutex mutex;
+        double lower_bound;
+        size_t best_makespan = std::numeric_limits<size_t>::max();
+        // the backend which found the best schedule
+        std::string leader;
+        std::exception_ptr member_exception;
+    };
+
+    void run_member(const std::string &backend_name, uint64_t seed, const SolverContext &context,
+                    RaceState &race_state) const;
+    // records a schedule or a bound of a backend, the race stops once the gap is closed
+    void update(RaceState &race_state, const std::string &backend_name, size_t makespan, double bound) const;
+
+    const ProblemInstance &problem_instance;
+    std::vector<std::string> backend_names;
+    size_t makespan_lower_bound = 0;
+};
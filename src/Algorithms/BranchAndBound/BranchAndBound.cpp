@@ -0,0 +1,728 @@
+#include "Algorithms/BranchAndBound/BranchAndBound.hpp"
+#include "External/pempek_assert.hpp"
+#include "Settings.hpp"
+#include "loguru.hpp"
+#include <algorithm>
+#include <format>
+#include <limits>
+#include <thread>
+#include <tuple>
+
+static constexpr size_t unscheduled = std::numeric_limits<size_t>::max();
+
+static size_t get_nb_workers()
+{
+    const size_t nb_workers = Settings::Solver::BRANCH_AND_BOUND_WORKERS == 0
+                                  ? Settings::Solver::NB_THREADS
+                                  : Settings::Solver::BRANCH_AND_BOUND_WORKERS;
+    return std::max<size_t>(nb_workers, 1);
+}
+
+// depth-first search from the subtree roots taken by one thread, the partial schedule is updated in place
+class BranchAndBound::Worker
+{
+  public:
+    Worker(const BranchAndBound &branch_and_bound, size_t worker_index, SearchState &search_state);
+
+    void replay(const Node &node);
+    void explore();
+
+  private:
+    struct Child
+    {
+        size_t lower_bound;
+        size_t job_index;
+        size_t mode_index;
+        size_t start_time;
+    };
+
+    size_t get_earliest_start(size_t job_index, size_t mode_index) const;
+    size_t get_precedence_start(size_t job_index) const;
+    bool fits(size_t mode_index, size_t start_time) const;
+    void schedule(size_t job_index, size_t mode_index, size_t start_time);
+    void unschedule(size_t job_index, size_t previous_last_start, size_t previous_max_finish);
+    size_t compute_lower_bound() const;
+    bool is_dominated_cutset();
+    bool should_donate() const;
+    bool is_stopped();
+
+    const BranchAndBound &branch_and_bound;
+    const PrecedenceGraph &precedence_graph;
+    size_t worker_index;
+    SearchState &search_state;
+    size_t nb_jobs;
+    size_t nb_resources;
+
+    std::vector<size_t> start_times;
+    std::vector<size_t> job_modes;
+    std::vector<size_t> nb_unscheduled_predecessors;
+    std::vector<uint64_t> scheduled_jobs;
+    // usage[t * nb_resources + r] of resource r at time t
+    std::vector<size_t> usage;
+    std::vector<size_t> remaining_energies;
+    size_t nb_scheduled = 0;
+    size_t last_start = 0;
+    size_t max_finish = 0;
+    Node decisions;
+    size_t nb_explored_nodes = 0;
+    mutable std::vector<size_t> heads;
+};
+
+BranchAndBound::Worker::Worker(const BranchAndBound &branch_and_bound, size_t worker_index,
+                               SearchState &search_state)
+    : branch_and_bound(branch_and_bound), precedence_graph(branch_and_bound.precedence_graph),
+      worker_index(worker_index), search_state(search_state), nb_jobs(precedence_graph.get_nb_jobs()),
+      nb_resources(branch_and_bound.capacities.size()), heads(nb_jobs)
+{}
+
+void BranchAndBound::Worker::replay(const Node &node)
+{
+    start_times.assign(nb_jobs, unscheduled);
+    job_modes.assign(nb_jobs, unscheduled);
+    nb_unscheduled_predecessors.resize(nb_jobs);
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        nb_unscheduled_predecessors[job_index] = precedence_graph.get_predecessors(job_index).size();
+    }
+    scheduled_jobs.assign((nb_jobs + 63) / 64, 0);
+    usage.assign(branch_and_bound.horizon * nb_resources, 0);
+    remaining_energies.assign(nb_resources, 0);
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        for (size_t r = 0; r < nb_resources; ++r)
+        {
+            remaining_energies[r] += branch_and_bound.min_energies[job_index][r];
+        }
+    }
+    nb_scheduled = 0;
+    last_start = 0;
+    max_finish = 0;
+    decisions.clear();
+
+    for (const auto &[job_index, mode_index] : node)
+    {
+        schedule(job_index, mode_index, get_earliest_start(job_index, mode_index));
+    }
+}
+
+size_t BranchAndBound::Worker::get_precedence_start(size_t job_index) const
+{
+    size_t start_time = precedence_graph.get_release_time(job_index);
+    for (size_t pred_index : precedence_graph.get_predecessors(job_index))
+    {
+        start_time =
+            std::max(start_time, start_times[pred_index] + branch_and_bound.modes[job_modes[pred_index]].duration);
+    }
+    return start_time;
+}
+
+bool BranchAndBound::Worker::fits(size_t mode_index, size_t start_time) const
+{
+    const JobMode &mode = branch_and_bound.modes[mode_index];
+    for (size_t t = start_time; t < start_time + mode.duration; ++t)
+    {
+        for (size_t r = 0; r < nb_resources; ++r)
+        {
+            if (usage[t * nb_resources + r] + mode.demands[r] > branch_and_bound.capacities[r])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+size_t BranchAndBound::Worker::get_earliest_start(size_t job_index, size_t mode_index) const
+{
+    const JobMode &mode = branch_and_bound.modes[mode_index];
+    size_t start_time = std::max(last_start, get_precedence_start(job_index));
+
+    // on a conflict at time t the job cannot start before t + 1
+    for (size_t t = start_time; t < start_time + mode.duration; ++t)
+    {
+        for (size_t r = 0; r < nb_resources; ++r)
+        {
+            if (usage[t * nb_resources + r] + mode.demands[r] > branch_and_bound.capacities[r])
+            {
+                start_time = t + 1;
+                break;
+            }
+        }
+    }
+    return start_time;
+}
+
+void BranchAndBound::Worker::schedule(size_t job_index, size_t mode_index, size_t start_time)
+{
+    const JobMode &mode = branch_and_bound.modes[mode_index];
+    for (size_t t = start_time; t < start_time + mode.duration; ++t)
+    {
+        for (size_t r = 0; r < nb_resources; ++r)
+        {
+            usage[t * nb_resources + r] += mode.demands[r];
+        }
+    }
+    for (size_t r = 0; r < nb_resources; ++r)
+    {
+        remaining_energies[r] -= branch_and_bound.min_energies[job_index][r];
+    }
+    for (size_t succ_index : precedence_graph.get_successors(job_index))
+    {
+        --nb_unscheduled_predecessors[succ_index];
+    }
+    start_times[job_index] = start_time;
+    job_modes[job_index] = mode_index;
+    scheduled_jobs[job_index / 64] |= uint64_t{1} << (job_index % 64);
+    ++nb_scheduled;
+    last_start = start_time;
+    max_finish = std::max(max_finish, start_time + mode.duration);
+    decisions.emplace_back(job_index, mode_index);
+}
+
+void BranchAndBound::Worker::unschedule(size_t job_index, size_t previous_last_start, size_t previous_max_finish)
+{
+    const JobMode &mode = branch_and_bound.modes[job_modes[job_index]];
+    const size_t start_time = start_times[job_index];
+    for (size_t t = start_time; t < start_time + mode.duration; ++t)
+    {
+        for (size_t r = 0; r < nb_resources; ++r)
+        {
+            usage[t * nb_resources + r] -= mode.demands[r];
+        }
+    }
+    for (size_t r = 0; r < nb_resources; ++r)
+    {
+        remaining_energies[r] += branch_and_bound.min_energies[job_index][r];
+    }
+    for (size_t succ_index : precedence_graph.get_successors(job_index))
+    {
+        ++nb_unscheduled_predecessors[succ_index];
+    }
+    start_times[job_index] = unscheduled;
+    job_modes[job_index] = unscheduled;
+    scheduled_jobs[job_index / 64] &= ~(uint64_t{1} << (job_index % 64));
+    --nb_scheduled;
+    last_start = previous_last_start;
+    max_finish = previous_max_finish;
+    decisions.pop_back();
+}
+
+size_t BranchAndBound::Worker::compute_lower_bound() const
+{
+    const size_t best_makespan = search_state.best_makespan.load(std::memory_order_relaxed);
+    size_t lower_bound = max_finish;
+
+    // critical path of the unscheduled jobs, none of them starts before the last start time
+    for (size_t job_index : precedence_graph.get_topological_order())
+    {
+        if (start_times[job_index] != unscheduled)
+        {
+            continue;
+        }
+        size_t head = std::max(last_start, precedence_graph.get_release_time(job_index));
+        for (size_t pred_index : precedence_graph.get_predecessors(job_index))
+        {
+            const size_t pred_finish =
+                start_times[pred_index] == unscheduled
+                    ? heads[pred_index] + branch_and_bound.min_durations[pred_index]
+                    : start_times[pred_index] + branch_and_bound.modes[job_modes[pred_index]].duration;
+            head = std::max(head, pred_finish);
+        }
+        heads[job_index] = head;
+        lower_bound = std::max(lower_bound, head + branch_and_bound.tails[job_index]);
+    }
+    if (lower_bound >= best_makespan)
+    {
+        return lower_bound;
+    }
+
+    // the remaining energy of every resource must fit in the free capacity after the last start time
+    for (size_t r = 0; r < nb_resources; ++r)
+    {
+        size_t energy = remaining_energies[r];
+        size_t t = last_start;
+        for (; energy > 0 && t < branch_and_bound.horizon && t < best_makespan; ++t)
+        {
+            energy -= std::min(energy, branch_and_bound.capacities[r] - usage[t * nb_resources + r]);
+        }
+        // a resource without capacity is only requested by zero demands
+        const size_t capacity = branch_and_bound.capacities[r];
+        if (capacity > 0)
+        {
+            lower_bound = std::max(lower_bound, t + (energy + capacity - 1) / capacity);
+        }
+    }
+    return lower_bound;
+}
+
+bool BranchAndBound::Worker::is_dominated_cutset()
+{
+    CutsetEntry entry;
+    entry.last_start = last_start;
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        if (start_times[job_index] != unscheduled)
+        {
+            const size_t finish_time = start_times[job_index] + branch_and_bound.modes[job_modes[job_index]].duration;
+            if (finish_time > last_start)
+            {
+                entry.running_jobs.push_back({job_index, job_modes[job_index], finish_time});
+            }
+        }
+    }
+    return search_state.cutset_store.is_dominated(scheduled_jobs, std::move(entry), branch_and_bound.modes);
+}
+
+bool BranchAndBound::Worker::should_donate() const
+{
+    if (search_state.nb_idle_workers.load(std::memory_order_relaxed) == 0 || nb_scheduled + 2 >= nb_jobs)
+    {
+        return false;
+    }
+    WorkerQueue &queue = search_state.queues[worker_index];
+    std::scoped_lock lock(queue.mutex);
+    return queue.nodes.empty();
+}
+
+bool BranchAndBound::Worker::is_stopped()
+{
+    if (++nb_explored_nodes % 1024 == 0)
+    {
+        if (std::chrono::steady_clock::now() >= search_state.deadline || branch_and_bound.stop_token.stop_requested())
+        {
+            search_state.stopped.store(true, std::memory_order_relaxed);
+        }
+        branch_and_bound.import_incumbent(search_state);
+    }
+    return search_state.stopped.load(std::memory_order_relaxed);
+}
+
+void BranchAndBound::Worker::explore()
+{
+    if (is_stopped())
+    {
+        return;
+    }
+    if (nb_scheduled == nb_jobs)
+    {
+        if (max_finish < search_state.best_makespan.load(std::memory_order_relaxed))
+        {
+            branch_and_bound.publish(search_state, start_times, job_modes);
+        }
+        return;
+    }
+    if (compute_lower_bound() >= search_state.best_makespan.load(std::memory_order_relaxed) || is_dominated_cutset())
+    {
+        return;
+    }
+
+    std::vector<Child> children;
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        if (start_times[job_index] != unscheduled || nb_unscheduled_predecessors[job_index] > 0)
+        {
+            continue;
+        }
+        const size_t precedence_start = get_precedence_start(job_index);
+        for (size_t mode_index = branch_and_bound.first_modes[job_index];
+             mode_index < branch_and_bound.first_modes[job_index + 1]; ++mode_index)
+        {
+            const size_t start_time = get_earliest_start(job_index, mode_index);
+
+            // left shift rule: a schedule where the job can start before the previous level one is not active
+            bool left_shift = false;
+            for (size_t t = precedence_start; t < last_start && !left_shift; ++t)
+            {
+                left_shift = fits(mode_index, t);
+            }
+            if (!left_shift)
+            {
+                const size_t lower_bound = start_time + branch_and_bound.modes[mode_index].duration +
+                                           branch_and_bound.tails[job_index] -
+                                           branch_and_bound.min_durations[job_index];
+                children.emplace_back(lower_bound, job_index, mode_index, start_time);
+            }
+        }
+    }
+    std::ranges::sort(children, std::ranges::less{},
+                      [](const Child &child) { return std::pair(child.lower_bound, child.start_time); });
+
+    const size_t previous_last_start = last_start;
+    const size_t previous_max_finish = max_finish;
+    for (size_t child_index = 0; child_index < children.size(); ++child_index)
+    {
+        const Child &child = children[child_index];
+        if (search_state.stopped.load(std::memory_order_relaxed) ||
+            child.lower_bound >= search_state.best_makespan.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        // the first child is always explored by this worker, the siblings are shared while other workers are idle
+        if (child_index > 0 && should_donate())
+        {
+            Node node = decisions;
+            node.emplace_back(child.job_index, child.mode_index);
+            search_state.nb_pending_nodes.fetch_add(1);
+            {
+                WorkerQueue &queue = search_state.queues[worker_index];
+                std::scoped_lock lock(queue.mutex);
+                queue.nodes.emplace_back(std::move(node));
+            }
+            search_state.wake_idle_workers();
+            continue;
+        }
+
+        schedule(child.job_index, child.mode_index, child.start_time);
+        explore();
+        unschedule(child.job_index, previous_last_start, previous_max_finish);
+    }
+}
+
+BranchAndBound::CutsetStore::CutsetStore(size_t max_nb_entries) : max_nb_entries(max_nb_entries) {}
+
+size_t BranchAndBound::CutsetStore::Hash::operator()(const std::vector<uint64_t> &bitset) const
+{
+    size_t hash = 0;
+    for (uint64_t word : bitset)
+    {
+        hash ^= std::hash<uint64_t>{}(word) + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+bool BranchAndBound::CutsetStore::is_dominated(const std::vector<uint64_t> &scheduled_jobs, CutsetEntry entry,
+                                               const std::vector<JobMode> &modes)
+{
+    // an explored partial schedule dominates when it started its last job no later and every job it still runs
+    // after the current last start time ends no later, in a mode using no more resources
+    auto dominates = [&entry, &modes](const CutsetEntry &explored) {
+        if (explored.last_start > entry.last_start)
+        {
+            return false;
+        }
+        return std::ranges::all_of(explored.running_jobs, [&entry, &modes](const std::array<size_t, 3> &job) {
+            const auto &[job_index, mode_index, finish_time] = job;
+            if (finish_time <= entry.last_start)
+            {
+                return true;
+            }
+            auto it = std::ranges::lower_bound(entry.running_jobs, job_index, std::ranges::less{},
+                                               [](const std::array<size_t, 3> &running) { return running[0]; });
+            if (it == entry.running_jobs.end() || (*it)[0] != job_index || finish_time > (*it)[2])
+            {
+                return false;
+            }
+            return std::ranges::equal(modes[mode_index].demands, modes[(*it)[1]].demands, std::ranges::less_equal{});
+        });
+    };
+
+    Shard &shard = shards[Hash{}(scheduled_jobs) % nb_shards];
+    std::scoped_lock lock(shard.mutex);
+    auto it = shard.entries.find(scheduled_jobs);
+    if (it != shard.entries.end() && std::ranges::any_of(it->second, dominates))
+    {
+        return true;
+    }
+    if (nb_entries.load(std::memory_order_relaxed) < max_nb_entries)
+    {
+        nb_entries.fetch_add(1, std::memory_order_relaxed);
+        shard.entries[scheduled_jobs].emplace_back(std::move(entry));
+    }
+    return false;
+}
+
+BranchAndBound::SearchState::SearchState(std::vector<IncumbentListener> listeners, size_t nb_workers,
+                                         std::chrono::steady_clock::time_point deadline, size_t makespan_lower_bound)
+    : deadline(deadline), makespan_lower_bound(makespan_lower_bound), queues(nb_workers),
+      best_makespan(std::numeric_limits<size_t>::max()),
+      cutset_store(Settings::Solver::BRANCH_AND_BOUND_CUTSET_LIMIT), incumbent_publisher(std::move(listeners))
+{}
+
+void BranchAndBound::SearchState::wake_idle_workers()
+{
+    // a worker checks the state and starts waiting while holding the mutex, so it cannot miss the change
+    {
+        std::scoped_lock lock(idle_mutex);
+    }
+    idle_condition.notify_all();
+}
+
+BranchAndBound::BranchAndBound(const ProblemInstance &problem_instance)
+    : precedence_graph(problem_instance),
+      makespan_lower_bound(
+          std::max(precedence_graph.compute_critical_path_length(), problem_instance.compute_energy_lower_bound()))
+{
+    for (const auto &resource : problem_instance.get_resources())
+    {
+        capacities.emplace_back(resource.units);
+    }
+
+    const size_t nb_jobs = precedence_graph.get_nb_jobs();
+    size_t max_release_time = 0;
+    size_t sum_max_durations = 0;
+    first_modes.emplace_back(0);
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        const JobConstPtr &job = precedence_graph.get_job(job_index);
+
+        // non-executable modes exceed a capacity
+        std::vector<JobMode> job_modes;
+        for (size_t mode_index = 0; mode_index < job->modes.size(); ++mode_index)
+        {
+            JobMode mode{mode_index + 1, job->modes[mode_index].processing_time, {}};
+            for (const auto &requested_resource : job->modes[mode_index].requested_resources)
+            {
+                mode.demands.emplace_back(requested_resource.units);
+            }
+            if (std::ranges::equal(mode.demands, capacities, std::ranges::less_equal{}))
+            {
+                job_modes.emplace_back(std::move(mode));
+            }
+        }
+        PPK_ASSERT_ERROR(!job_modes.empty(), "Job %s has no executable mode", job->id.c_str());
+
+        // inefficient modes are not shorter than another mode using no fewer resources; sorted by duration, then
+        // demands, every mode comes after the modes dominating it, and of identical modes the first one is kept
+        std::ranges::sort(job_modes, std::ranges::less{},
+                          [](const JobMode &mode) { return std::tie(mode.duration, mode.demands, mode.mode_id); });
+        std::vector<JobMode> efficient_modes;
+        for (auto &mode : job_modes)
+        {
+            const bool inefficient = std::ranges::any_of(efficient_modes, [&mode](const JobMode &efficient_mode) {
+                return std::ranges::equal(efficient_mode.demands, mode.demands, std::ranges::less_equal{});
+            });
+            if (!inefficient)
+            {
+                efficient_modes.emplace_back(std::move(mode));
+            }
+        }
+
+        min_durations.emplace_back(efficient_modes.front().duration);
+        std::vector<size_t> job_min_energies(capacities.size(), std::numeric_limits<size_t>::max());
+        for (const auto &mode : efficient_modes)
+        {
+            for (size_t r = 0; r < capacities.size(); ++r)
+            {
+                job_min_energies[r] = std::min(job_min_energies[r], mode.duration * mode.demands[r]);
+            }
+        }
+        min_energies.emplace_back(std::move(job_min_energies));
+        sum_max_durations += efficient_modes.back().duration;
+        max_release_time = std::max(max_release_time, precedence_graph.get_release_time(job_index));
+
+        std::ranges::move(efficient_modes, std::back_inserter(modes));
+        first_modes.emplace_back(modes.size());
+    }
+    horizon = max_release_time + sum_max_durations + 1;
+
+    tails.assign(nb_jobs, 0);
+    const auto &topological_order = precedence_graph.get_topological_order();
+    for (auto it = topological_order.rbegin(); it != topological_order.rend(); ++it)
+    {
+        size_t longest_successor_tail = 0;
+        for (size_t succ_index : precedence_graph.get_successors(*it))
+        {
+            longest_successor_tail = std::max(longest_successor_tail, tails[succ_index]);
+        }
+        tails[*it] = min_durations[*it] + longest_successor_tail;
+    }
+}
+
+void BranchAndBound::add_incumbent_listener(IncumbentListener listener)
+{
+    incumbent_listeners.emplace_back(std::move(listener));
+}
+
+void BranchAndBound::set_stop_token(std::stop_token stop_token) { this->stop_token = std::move(stop_token); }
+
+void BranchAndBound::set_incumbent_source(const IncumbentStore &incumbent_store)
+{
+    incumbent_source = &incumbent_store;
+}
+
+Solution BranchAndBound::solve()
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                      std::chrono::duration<double>(Settings::Solver::MAX_RUNTIME));
+    const size_t nb_workers = get_nb_workers();
+    SearchState search_state(incumbent_listeners, nb_workers, deadline, makespan_lower_bound);
+    import_incumbent(search_state);
+    search_state.nb_pending_nodes.store(1);
+    search_state.queues[0].nodes.emplace_back();
+
+    {
+        std::vector<std::jthread> workers;
+        for (size_t worker_index = 0; worker_index < nb_workers; ++worker_index)
+        {
+            workers.emplace_back([this, worker_index, &search_state] {
+                try
+                {
+                    run_worker(worker_index, search_state);
+                } catch (...)
+                {
+                    std::scoped_lock lock(search_state.publisher_mutex);
+                    if (!search_state.worker_exception)
+                    {
+                        search_state.worker_exception = std::current_exception();
+                    }
+                    search_state.stopped.store(true);
+                    search_state.wake_idle_workers();
+                }
+            });
+        }
+    }
+
+    if (search_state.worker_exception)
+    {
+        std::rethrow_exception(search_state.worker_exception);
+    }
+
+    Solution solution;
+    solution.runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    solution.solver_configuration = std::format("BranchAndBound workers={} cutset_limit={}", nb_workers,
+                                                Settings::Solver::BRANCH_AND_BOUND_CUTSET_LIMIT);
+
+    // an exhausted search proves the incumbent optimal, or the instance infeasible
+    const bool exhausted = !search_state.stopped.load();
+    if (!search_state.best.has_value())
+    {
+        solution.solution_state = exhausted ? SolutionState::INFEASIBLE : SolutionState::UNKNOWN;
+        return solution;
+    }
+
+    const Incumbent &best = *search_state.best;
+    solution.solution_state =
+        exhausted || best.makespan == makespan_lower_bound ? SolutionState::OPTIMAL : SolutionState::FEASIBLE;
+    solution.makespan = best.makespan;
+    solution.objective_bound = static_cast<double>(exhausted ? best.makespan : makespan_lower_bound);
+    solution.gap = (static_cast<double>(best.makespan) - solution.objective_bound) / static_cast<double>(best.makespan);
+    solution.job_allocations = best.job_allocations;
+    LOG_F(INFO, "branch and bound: makespan = %zu, bound = %f, runtime = %f s", solution.makespan,
+          solution.objective_bound, solution.runtime);
+    return solution;
+}
+
+void BranchAndBound::run_worker(size_t worker_index, SearchState &search_state) const
+{
+    Worker worker(*this, worker_index, search_state);
+    bool idle = false;
+    while (!search_state.stopped.load(std::memory_order_relaxed))
+    {
+        // counted before looking at the queues, so that a node donated in the meantime ends the wait below
+        const size_t nb_pending_nodes = search_state.nb_pending_nodes.load();
+        std::optional<Node> node = take_node(worker_index, search_state);
+        if (!node.has_value())
+        {
+            if (!idle)
+            {
+                idle = true;
+                search_state.nb_idle_workers.fetch_add(1);
+            }
+            // no node is waiting nor being explored, the search is exhausted
+            if (nb_pending_nodes == 0)
+            {
+                break;
+            }
+            std::unique_lock lock(search_state.idle_mutex);
+            search_state.idle_condition.wait(lock, [&search_state, nb_pending_nodes] {
+                return search_state.nb_pending_nodes.load() != nb_pending_nodes || search_state.stopped.load();
+            });
+            continue;
+        }
+        if (idle)
+        {
+            idle = false;
+            search_state.nb_idle_workers.fetch_sub(1);
+        }
+
+        worker.replay(*node);
+        worker.explore();
+        if (search_state.nb_pending_nodes.fetch_sub(1) == 1 || search_state.stopped.load(std::memory_order_relaxed))
+        {
+            search_state.wake_idle_workers();
+        }
+    }
+}
+
+std::optional<BranchAndBound::Node> BranchAndBound::take_node(size_t worker_index, SearchState &search_state) const
+{
+    // the own queue is used as a stack, the oldest and largest subtrees are stolen from the other queues
+    {
+        WorkerQueue &queue = search_state.queues[worker_index];
+        std::scoped_lock lock(queue.mutex);
+        if (!queue.nodes.empty())
+        {
+            Node node = std::move(queue.nodes.back());
+            queue.nodes.pop_back();
+            return node;
+        }
+    }
+    for (size_t offset = 1; offset < search_state.queues.size(); ++offset)
+    {
+        WorkerQueue &queue = search_state.queues[(worker_index + offset) % search_state.queues.size()];
+        std::scoped_lock lock(queue.mutex);
+        if (!queue.nodes.empty())
+        {
+            Node node = std::move(queue.nodes.front());
+            queue.nodes.pop_front();
+            return node;
+        }
+    }
+    return std::nullopt;
+}
+
+void BranchAndBound::publish(SearchState &search_state, const std::vector<size_t> &start_times,
+                             const std::vector<size_t> &job_modes) const
+{
+    Incumbent incumbent;
+    for (size_t job_index = 0; job_index < precedence_graph.get_nb_jobs(); ++job_index)
+    {
+        const JobMode &mode = modes[job_modes[job_index]];
+        JobAllocation job_allocation;
+        job_allocation.job_id = precedence_graph.get_job(job_index)->id;
+        job_allocation.start_time = start_times[job_index];
+        job_allocation.duration = mode.duration;
+        job_allocation.mode_id = mode.mode_id;
+        incumbent.makespan = std::max(incumbent.makespan, job_allocation.start_time + job_allocation.duration);
+        incumbent.job_allocations.emplace_back(std::move(job_allocation));
+    }
+
+    std::scoped_lock lock(search_state.publisher_mutex);
+    if (incumbent.makespan >= search_state.best_makespan.load())
+    {
+        return;
+    }
+    search_state.best_makespan.store(incumbent.makespan);
+    search_state.incumbent_publisher.publish(incumbent.makespan, static_cast<double>(search_state.makespan_lower_bound),
+                                             incumbent.job_allocations);
+    search_state.best = std::move(incumbent);
+    if (search_state.best->makespan <= search_state.makespan_lower_bound)
+    {
+        search_state.stopped.store(true);
+    }
+}
+
+// the imported schedule is not published again, it only prunes and is returned if nothing better is found
+void BranchAndBound::import_incumbent(SearchState &search_state) const
+{
+    if (incumbent_source == nullptr ||
+        incumbent_source->get_best_makespan() >= search_state.best_makespan.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    std::optional<Incumbent> incumbent = incumbent_source->get_best();
+    std::scoped_lock lock(search_state.publisher_mutex);
+    if (!incumbent.has_value() || incumbent->makespan >= search_state.best_makespan.load())
+    {
+        return;
+    }
+    search_state.best_makespan.store(incumbent->makespan);
+    search_state.best = std::move(incumbent);
+    if (search_state.best->makespan <= search_state.makespan_lower_bound)
+    {
+        search_state.stopped.store(true);
+    }
+}
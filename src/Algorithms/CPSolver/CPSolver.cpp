@@ -3,62 +3,266 @@
 #include "Shared/Exceptions.hpp"
 #include "Solution/Solution.hpp"
 #include "loguru.hpp"
+#include <algorithm>
+#include <format>
+#include <numeric>
+#include <ranges>
+#include <stop_token>
 
-CPSolver::CPSolver(const ProblemInstance &problem_instance) : problem_instance(problem_instance) {}
+static double get_processing_time(const Mode &mode, const std::vector<Resource> &)
+{
+    return static_cast<double>(mode.processing_time);
+}
 
-Solution CPSolver::solve()
+static double get_resource_utilisation(const Mode &mode, const std::vector<Resource> &resources)
+{
+    double resource_utilisation = 0.0;
+    for (size_t resource_index = 0; resource_index < resources.size(); ++resource_index)
+    {
+        if (resources[resource_index].units > 0)
+        {
+            resource_utilisation += static_cast<double>(mode.requested_resources.at(resource_index).units) /
+                                    static_cast<double>(resources[resource_index].units);
+        }
+    }
+    return resource_utilisation;
+}
+
+static size_t get_nb_workers()
+{
+    return Settings::Solver::CP_WORKERS == 0 ? Settings::Solver::NB_THREADS : Settings::Solver::CP_WORKERS;
+}
+
+CPSolver::CPSolver(const ProblemInstance &problem_instance)
+    : problem_instance(problem_instance), precedence_graph(problem_instance), model(env), nb_workers(get_nb_workers())
 {
-    Solution solution;
-    IloEnv env;
     try
     {
-        IloModel model(env);
-        tasks = IloIntervalVarArray(env, problem_instance.job_queue.nb_elements());
-        modes = IloIntervalVarArray2(env, problem_instance.job_queue.nb_elements());
-        starts = IloIntExprArray(env);
-        ends = IloIntExprArray(env);
+        build_model();
+    } catch (IloException &ex)
+    {
+        env.end();
+        throw CustomException(std::source_location::current(), ex.getMessage());
+    } catch (...)
+    {
+        env.end();
+        throw_with_nested(CustomException(std::source_location::current(), "Error during building the CP model!"));
+    }
+}
+
+CPSolver::~CPSolver() { env.end(); }
+
+void CPSolver::build_model()
+{
+    const size_t nb_jobs = problem_instance.job_queue.nb_elements();
+    tasks = IloIntervalVarArray(env, nb_jobs);
+    modes = IloIntervalVarArray2(env, nb_jobs);
+    starts = IloIntExprArray(env);
+    ends = IloIntExprArray(env);
+
+    size_t nb_resources = problem_instance.resources.size();
+
+    processes = IloCumulFunctionExprArray(env, nb_resources);
+    capacities = IloIntArray(env, nb_resources);
+
+    release_times.resize(nb_jobs);
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        release_times[job_index] = precedence_graph.get_release_time(job_index);
+    }
+    frozen_jobs.assign(nb_jobs, false);
+    fixed_mode_ids.assign(nb_jobs, 0);
 
-        size_t nb_resources = problem_instance.resources.size();
+    init_resource_arrays(model);
+    add_job_start_time_constraints(model);
+    add_job_modes_constraints(model);
+    add_capacity_constraints(model);
+    add_precedence_constraints(model);
+    add_objective(model);
 
-        processes = IloCumulFunctionExprArray(env, nb_resources);
-        capacities = IloIntArray(env, nb_resources);
+    if (Settings::Solver::CP_REDUNDANT_CUMULATIVE)
+    {
+        add_redundant_cumulative_constraints(model);
+    }
+    if (Settings::Solver::CP_UNARY_NO_OVERLAP)
+    {
+        add_unary_resource_constraints(model);
+    }
+    update_start_time_bounds();
+    add_search_phases(model);
 
-        init_resource_arrays(model);
-        add_job_start_time_constraints(model);
-        add_job_modes_constraints(model);
-        add_capacity_constraints(model);
-        add_precedence_constraints(model);
-        add_objective(model);
+    cp = IloCP(model);
+    if (search_phases.getSize() > 0)
+    {
+        cp.setSearchPhases(search_phases);
+    }
+    starting_point = IloSolution(env);
+}
+
+Solution CPSolver::solve(double time_limit)
+{
+    Solution solution;
+    try
+    {
+        if (has_starting_point)
+        {
+            cp.setStartingPoint(starting_point);
+        }
 
-        IloCP cp(model);
-        solve_cp_model(cp, model);
-        set_solution_status(cp, solution);
+        solve_cp_model(solution, time_limit);
+        solution.solver_configuration = get_solver_configuration();
 
         if (solution.solution_state == SolutionState::OPTIMAL || solution.solution_state == SolutionState::FEASIBLE)
         {
-            set_solution(cp, solution);
+            // the next solve after an edit of the model is warm started from this solution
+            set_starting_point(solution);
+            LOG_F(1, "Solution details updated successfully");
         } else
         {
-            LOG_F(INFO, "CP Model is not solvable within the time limit of %f, solution status: %s",
-                  Settings::Solver::MAX_RUNTIME, solution_state_as_string(solution.solution_state).c_str());
+            LOG_F(INFO, "CP Model is not solvable within the time limit of %f, solution status: %s", time_limit,
+                  solution_state_as_string(solution.solution_state).c_str());
         }
-
-        cp.end();
-
     } catch (IloException &ex)
     {
-        env.end();
         throw CustomException(std::source_location::current(), ex.getMessage());
     } catch (...)
     {
-        env.end();
         throw_with_nested(CustomException(std::source_location::current(), "Error during solving the CP model!"));
     }
 
-    env.end();
     return solution;
 }
 
+void CPSolver::add_incumbent_listener(IncumbentListener listener)
+{
+    incumbent_listeners.emplace_back(std::move(listener));
+}
+
+void CPSolver::set_release_time(const std::string &job_id, size_t release_time)
+{
+    release_times[precedence_graph.get_job_index(job_id)] = release_time;
+    update_start_time_bounds();
+}
+
+void CPSolver::fix_mode(const std::string &job_id, size_t mode_id)
+{
+    select_mode(job_id, mode_id);
+    fixed_mode_ids[precedence_graph.get_job_index(job_id)] = mode_id;
+}
+
+void CPSolver::select_mode(const std::string &job_id, size_t mode_id)
+{
+    const size_t job_index = precedence_graph.get_job_index(job_id);
+    PPK_ASSERT_ERROR(mode_id >= 1 && mode_id <= static_cast<size_t>(modes[job_index].getSize()),
+                     "job %s has no mode %zu", job_id.c_str(), mode_id);
+
+    for (IloInt mode_index = 0; mode_index < modes[job_index].getSize(); ++mode_index)
+    {
+        if (static_cast<size_t>(mode_index) + 1 == mode_id)
+        {
+            modes[job_index][mode_index].setPresent();
+        } else
+        {
+            modes[job_index][mode_index].setAbsent();
+        }
+    }
+}
+
+void CPSolver::freeze_job(const std::string &job_id, size_t start_time, size_t mode_id)
+{
+    select_mode(job_id, mode_id);
+
+    const size_t job_index = precedence_graph.get_job_index(job_id);
+    tasks[job_index].setStartMin(static_cast<IloInt>(start_time));
+    tasks[job_index].setStartMax(static_cast<IloInt>(start_time));
+    frozen_jobs[job_index] = true;
+}
+
+void CPSolver::freeze_schedule_prefix(const Solution &solution, size_t time)
+{
+    for (const auto &job_allocation : solution.job_allocations)
+    {
+        if (job_allocation.start_time < time)
+        {
+            freeze_job(job_allocation.job_id, job_allocation.start_time, job_allocation.mode_id);
+        }
+    }
+}
+
+void CPSolver::restrict_job(const std::string &job_id, size_t latest_start_time, size_t mode_id)
+{
+    select_mode(job_id, mode_id);
+
+    const size_t job_index = precedence_graph.get_job_index(job_id);
+    tasks[job_index].setStartMax(static_cast<IloInt>(latest_start_time));
+    if (frozen_jobs[job_index])
+    {
+        frozen_jobs[job_index] = false;
+        tasks[job_index].setStartMin(static_cast<IloInt>(release_times[job_index]));
+    }
+}
+
+void CPSolver::unfreeze_job(const std::string &job_id) { unfreeze_jobs({job_id}); }
+
+void CPSolver::unfreeze_jobs(const std::vector<std::string> &job_ids)
+{
+    for (const auto &job_id : job_ids)
+    {
+        const size_t job_index = precedence_graph.get_job_index(job_id);
+        if (fixed_mode_ids[job_index] != 0)
+        {
+            select_mode(job_id, fixed_mode_ids[job_index]);
+        } else
+        {
+            for (IloInt mode_index = 0; mode_index < modes[job_index].getSize(); ++mode_index)
+            {
+                modes[job_index][mode_index].setOptional();
+            }
+        }
+
+        tasks[job_index].setStartMax(IloIntervalMax);
+        frozen_jobs[job_index] = false;
+    }
+    update_start_time_bounds();
+}
+
+void CPSolver::set_nb_workers(size_t nb_workers) { this->nb_workers = nb_workers; }
+
+void CPSolver::set_stop_token(std::stop_token stop_token) { this->stop_token = std::move(stop_token); }
+
+void CPSolver::set_starting_point(const Solution &solution)
+{
+    starting_point.end();
+    starting_point = IloSolution(env);
+
+    for (const auto &job_allocation : solution.job_allocations)
+    {
+        const size_t job_index = precedence_graph.get_job_index(job_allocation.job_id);
+        const auto start_time = static_cast<IloInt>(job_allocation.start_time);
+        const auto end_time = static_cast<IloInt>(job_allocation.start_time + job_allocation.duration);
+
+        starting_point.add(tasks[job_index]);
+        starting_point.setStart(tasks[job_index], start_time);
+        starting_point.setEnd(tasks[job_index], end_time);
+
+        for (IloInt mode_index = 0; mode_index < modes[job_index].getSize(); ++mode_index)
+        {
+            const IloIntervalVar &mode = modes[job_index][mode_index];
+            starting_point.add(mode);
+            if (static_cast<size_t>(mode_index) + 1 == job_allocation.mode_id)
+            {
+                starting_point.setPresent(mode);
+                starting_point.setStart(mode, start_time);
+                starting_point.setEnd(mode, end_time);
+            } else
+            {
+                starting_point.setAbsent(mode);
+            }
+        }
+    }
+    has_starting_point = true;
+}
+
 void CPSolver::init_resource_arrays(const IloModel &model)
 {
     IloEnv env = model.getEnv();
@@ -123,19 +327,23 @@ void CPSolver::add_precedence_constraints(const IloModel &model) const
 {
     IloEnv env = model.getEnv();
 
-    size_t job_index = 0;
-    for (const JobConstPtr &job : this->problem_instance.job_queue)
+    // the arcs implied by longer paths are enforced by propagation along these paths
+    std::vector<std::vector<size_t>> reduced_successors;
+    if (Settings::Solver::CP_TRANSITIVE_REDUCTION)
+    {
+        reduced_successors = precedence_graph.compute_transitive_reduction();
+    }
+
+    // the precedence graph numbers the jobs in queue order, like the interval variables
+    for (size_t job_index = 0; job_index < precedence_graph.get_nb_jobs(); ++job_index)
     {
-        for (const auto &succ : job->successors)
+        const std::vector<size_t> &successors = Settings::Solver::CP_TRANSITIVE_REDUCTION
+                                                    ? reduced_successors[job_index]
+                                                    : precedence_graph.get_successors(job_index);
+        for (size_t succ_index : successors)
         {
-            const auto &succ_job = problem_instance.find_job(succ);
-            PPK_ASSERT_ERROR(succ_job, "successor job %s was not found", succ.c_str());
-            auto it = std::ranges::find(this->problem_instance.job_queue, succ_job);
-            PPK_ASSERT_ERROR(it != this->problem_instance.job_queue.end(), " Invalid Iterator");
-            size_t succ_index = std::distance(this->problem_instance.job_queue.begin(), it);
             model.add(IloEndBeforeStart(env, tasks[job_index], tasks[succ_index]));
         }
-        ++job_index;
     }
 }
 
@@ -147,20 +355,242 @@ void CPSolver::add_capacity_constraints(const IloModel &model) const
     }
 }
 
-void CPSolver::add_objective(const IloModel &model) const
+void CPSolver::add_redundant_cumulative_constraints(const IloModel &model) const
 {
     IloEnv env = model.getEnv();
 
-    IloObjective objective = IloMinimize(env, IloMax(ends));
-    model.add(objective);
+    // the master interval of a job is always present, it consumes at least the minimum demand over its modes
+    for (size_t resource_index = 0; resource_index < problem_instance.resources.size(); ++resource_index)
+    {
+        IloCumulFunctionExpr min_demand_process(env);
+        bool has_demand = false;
+
+        auto demand = [resource_index](const Mode &mode) { return mode.requested_resources.at(resource_index).units; };
+
+        size_t job_index = 0;
+        for (const JobConstPtr &job : problem_instance.job_queue)
+        {
+            const size_t min_demand = std::ranges::min(job->modes | std::views::transform(demand));
+            if (min_demand > 0)
+            {
+                min_demand_process += IloPulse(tasks[job_index], static_cast<IloInt>(min_demand));
+                has_demand = true;
+            }
+            ++job_index;
+        }
+
+        if (has_demand)
+        {
+            model.add(min_demand_process <= capacities[resource_index]);
+        }
+    }
+}
+
+void CPSolver::add_unary_resource_constraints(const IloModel &model) const
+{
+    IloEnv env = model.getEnv();
+
+    // two modes using a resource of capacity one cannot overlap, the sequence variable propagates this by edge finding
+    for (size_t resource_index = 0; resource_index < problem_instance.resources.size(); ++resource_index)
+    {
+        if (problem_instance.resources[resource_index].units != 1)
+        {
+            continue;
+        }
+
+        IloIntervalVarArray unary_modes(env);
+        size_t job_index = 0;
+        for (const JobConstPtr &job : problem_instance.job_queue)
+        {
+            for (size_t mode_index = 0; mode_index < job->modes.size(); ++mode_index)
+            {
+                if (job->modes[mode_index].requested_resources.at(resource_index).units > 0)
+                {
+                    unary_modes.add(modes[job_index][mode_index]);
+                }
+            }
+            ++job_index;
+        }
+
+        if (unary_modes.getSize() > 1)
+        {
+            model.add(IloNoOverlap(env, IloIntervalSequenceVar(env, unary_modes)));
+        }
+    }
+}
+
+void CPSolver::update_start_time_bounds()
+{
+    // the heads are only valid for the current release times, they are recomputed after every change
+    const std::vector<size_t> earliest_start_times =
+        Settings::Solver::CP_MAKESPAN_LOWER_BOUND ? precedence_graph.compute_heads(release_times) : release_times;
+    for (size_t job_index = 0; job_index < earliest_start_times.size(); ++job_index)
+    {
+        if (!frozen_jobs[job_index])
+        {
+            tasks[job_index].setStartMin(static_cast<IloInt>(earliest_start_times[job_index]));
+        }
+    }
+
+    if (!Settings::Solver::CP_MAKESPAN_LOWER_BOUND)
+    {
+        return;
+    }
+
+    const size_t critical_path_length = precedence_graph.compute_critical_path_length(release_times);
+    const size_t energy_lower_bound = problem_instance.compute_energy_lower_bound();
+    const size_t makespan_lower_bound = std::max(critical_path_length, energy_lower_bound);
+    LOG_F(1, "CP makespan lower bound = %zu (critical path %zu, energy %zu)", makespan_lower_bound,
+          critical_path_length, energy_lower_bound);
+
+    if (makespan_lower_bound_constraint.getImpl() != nullptr)
+    {
+        model.remove(makespan_lower_bound_constraint);
+        makespan_lower_bound_constraint.end();
+    }
+    makespan_lower_bound_constraint = makespan >= static_cast<IloInt>(makespan_lower_bound);
+    model.add(makespan_lower_bound_constraint);
 }
 
-void CPSolver::solve_cp_model(IloCP &cp, const IloModel &model) const
+void CPSolver::add_objective(const IloModel &model)
 {
     IloEnv env = model.getEnv();
 
-    cp.setParameter(IloCP::TimeLimit, Settings::Solver::MAX_RUNTIME);
-    cp.setParameter(IloCP::Workers, 1);
+    makespan = IloMax(ends);
+    IloObjective objective = IloMinimize(env, makespan);
+    model.add(objective);
+}
+
+const std::map<std::string, IloCP::ParameterValues, std::less<>> &CPSolver::get_search_types()
+{
+    static const std::map<std::string, IloCP::ParameterValues, std::less<>> search_types = {
+        {"Restart", IloCP::Restart}, {"DepthFirst", IloCP::DepthFirst}, {"MultiPoint", IloCP::MultiPoint}};
+    return search_types;
+}
+
+const std::map<std::string, CPSolver::TaskOrderingRule, std::less<>> &CPSolver::get_task_ordering_rules()
+{
+    static const std::map<std::string, TaskOrderingRule, std::less<>> task_ordering_rules = {
+        {"default", nullptr},
+        {"lft", &CPSolver::compute_latest_finish_times},
+        {"total_float", &CPSolver::compute_total_floats}};
+    return task_ordering_rules;
+}
+
+const std::map<std::string, CPSolver::ModePreferenceRule, std::less<>> &CPSolver::get_mode_preference_rules()
+{
+    static const std::map<std::string, ModePreferenceRule, std::less<>> mode_preference_rules = {
+        {"default", nullptr}, {"shortest", &get_processing_time}, {"least_resource", &get_resource_utilisation}};
+    return mode_preference_rules;
+}
+
+std::vector<double> CPSolver::compute_latest_finish_times() const
+{
+    const std::vector<size_t> tails = precedence_graph.compute_tails();
+    const size_t horizon = precedence_graph.compute_critical_path_length(release_times);
+
+    std::vector<double> latest_finish_times(tails.size());
+    for (size_t job_index = 0; job_index < tails.size(); ++job_index)
+    {
+        latest_finish_times[job_index] =
+            static_cast<double>(horizon + precedence_graph.get_min_processing_time(job_index) - tails[job_index]);
+    }
+    return latest_finish_times;
+}
+
+std::vector<double> CPSolver::compute_total_floats() const
+{
+    const std::vector<size_t> heads = precedence_graph.compute_heads(release_times);
+    const std::vector<size_t> tails = precedence_graph.compute_tails();
+    const size_t horizon = precedence_graph.compute_critical_path_length(release_times);
+
+    std::vector<double> total_floats(tails.size());
+    for (size_t job_index = 0; job_index < tails.size(); ++job_index)
+    {
+        total_floats[job_index] = static_cast<double>(horizon - tails[job_index] - heads[job_index]);
+    }
+    return total_floats;
+}
+
+void CPSolver::add_search_phases(const IloModel &model)
+{
+    const auto task_ordering_rule = get_task_ordering_rules().find(Settings::Solver::CP_SEARCH_PHASE);
+    PPK_ASSERT_ERROR(task_ordering_rule != get_task_ordering_rules().end(), "Unknown CP search phase %s",
+                     Settings::Solver::CP_SEARCH_PHASE.c_str());
+    const auto mode_preference_rule = get_mode_preference_rules().find(Settings::Solver::CP_MODE_PREFERENCE);
+    PPK_ASSERT_ERROR(mode_preference_rule != get_mode_preference_rules().end(), "Unknown CP mode preference %s",
+                     Settings::Solver::CP_MODE_PREFERENCE.c_str());
+
+    search_phases = IloSearchPhaseArray(env);
+    const size_t nb_jobs = precedence_graph.get_nb_jobs();
+
+    // the jobs are branched on by increasing priority, in queue order when no ordering rule is given
+    IloNumArray priorities(env, static_cast<IloInt>(nb_jobs));
+    if (task_ordering_rule->second != nullptr)
+    {
+        const std::vector<double> rule_priorities = std::invoke(task_ordering_rule->second, this);
+        for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+        {
+            priorities[job_index] = rule_priorities[job_index];
+        }
+    } else
+    {
+        for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+        {
+            priorities[job_index] = static_cast<double>(job_index);
+        }
+    }
+
+    if (mode_preference_rule->second != nullptr)
+    {
+        // the value of mode_ranks[j] is the rank of the selected mode of job j, the preferred mode has rank 0
+        IloIntVarArray mode_ranks(env, static_cast<IloInt>(nb_jobs));
+        for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+        {
+            const std::vector<Mode> &job_modes = precedence_graph.get_job(job_index)->modes;
+            std::vector<size_t> preference_order(job_modes.size());
+            std::iota(preference_order.begin(), preference_order.end(), 0);
+            std::ranges::stable_sort(preference_order, std::ranges::less{}, [&](size_t mode_index) {
+                return mode_preference_rule->second(job_modes[mode_index], problem_instance.resources);
+            });
+
+            mode_ranks[job_index] = IloIntVar(env, 0, static_cast<IloInt>(job_modes.size()) - 1);
+            for (size_t rank = 0; rank < preference_order.size(); ++rank)
+            {
+                model.add(IloPresenceOf(env, modes[job_index][preference_order[rank]]) ==
+                          (mode_ranks[job_index] == static_cast<IloInt>(rank)));
+            }
+        }
+        search_phases.add(IloSearchPhase(env, mode_ranks,
+                                         IloSelectSmallest(IloExplicitVarEval(env, mode_ranks, priorities)),
+                                         IloSelectSmallest(IloValue(env))));
+    }
+
+    if (task_ordering_rule->second != nullptr)
+    {
+        IloIntVarArray start_times(env, static_cast<IloInt>(nb_jobs));
+        for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+        {
+            start_times[job_index] = IloIntVar(env, 0, IloIntervalMax);
+            model.add(start_times[job_index] == starts[job_index]);
+        }
+        search_phases.add(IloSearchPhase(env, start_times,
+                                         IloSelectSmallest(IloExplicitVarEval(env, start_times, priorities)),
+                                         IloSelectSmallest(IloValue(env))));
+    }
+}
+
+void CPSolver::solve_cp_model(Solution &solution, double time_limit)
+{
+    auto search_type = get_search_types().find(Settings::Solver::CP_SEARCH_TYPE);
+    PPK_ASSERT_ERROR(search_type != get_search_types().end(), "Unknown CP search type %s",
+                     Settings::Solver::CP_SEARCH_TYPE.c_str());
+
+    cp.setParameter(IloCP::TimeLimit, time_limit);
+    cp.setParameter(IloCP::Workers, static_cast<IloInt>(nb_workers));
+    cp.setParameter(IloCP::SearchType, search_type->second);
+    cp.setParameter(IloCP::ParallelMode,
+                    Settings::Solver::CP_DETERMINISTIC_PARALLEL ? IloCP::Deterministic : IloCP::Opportunistic);
 
     cp.setParameter(IloCP::LogVerbosity, IloCP::Quiet);
 
@@ -168,36 +598,74 @@ void CPSolver::solve_cp_model(IloCP &cp, const IloModel &model) const
     cp.setWarning(env.getNullStream());
     cp.setError(env.getNullStream());
 
-    cp.solve();
+    IncumbentPublisher incumbent_publisher(incumbent_listeners);
+    bool solution_found = false;
+
+    // with an objective every call to next returns a solution improving the previous one, a stop requested before
+    // the search started aborts it as soon as the callback is registered
+    cp.startNewSearch();
+    std::stop_callback abort_search(stop_token, [this] { cp.abortSearch(); });
+    while (cp.next())
+    {
+        solution_found = true;
+        set_solution(cp, solution);
+        incumbent_publisher.publish(solution.makespan, solution.objective_bound, solution.job_allocations);
+    }
+    set_solution_status(cp, solution, solution_found);
+    cp.endSearch();
+}
+
+std::string CPSolver::get_solver_configuration() const
+{
+    std::string configuration =
+        std::format("CP Optimizer workers={} search={} parallel={}", nb_workers, Settings::Solver::CP_SEARCH_TYPE,
+                    Settings::Solver::CP_DETERMINISTIC_PARALLEL ? "deterministic" : "opportunistic");
+    if (Settings::Solver::CP_REDUNDANT_CUMULATIVE)
+    {
+        configuration += " redundant_cumulative";
+    }
+    if (Settings::Solver::CP_UNARY_NO_OVERLAP)
+    {
+        configuration += " unary_no_overlap";
+    }
+    if (Settings::Solver::CP_MAKESPAN_LOWER_BOUND)
+    {
+        configuration += " makespan_lower_bound";
+    }
+    if (Settings::Solver::CP_TRANSITIVE_REDUCTION)
+    {
+        configuration += " transitive_reduction";
+    }
+    if (Settings::Solver::CP_SEARCH_PHASE != "default")
+    {
+        configuration += std::format(" phase={}", Settings::Solver::CP_SEARCH_PHASE);
+    }
+    if (Settings::Solver::CP_MODE_PREFERENCE != "default")
+    {
+        configuration += std::format(" modes={}", Settings::Solver::CP_MODE_PREFERENCE);
+    }
+    return configuration;
 }
 
-void CPSolver::set_solution_status(const IloCP &cp, Solution &solution) const
+void CPSolver::set_solution_status(const IloCP &cp, Solution &solution, bool solution_found) const
 {
-    switch (cp.getStatus())
+    // the search is complete when the search space was exhausted before reaching any limit
+    const bool search_completed = cp.getInfo(IloCP::FailStatus) == IloCP::SearchHasFailedNormally;
+
+    using enum MODEL_STATUS;
+    if (solution_found && search_completed)
     {
-        using enum MODEL_STATUS;
-    case IloAlgorithm::Optimal:
         solution.solution_state = convert(MODEL_SOL_OPTIMAL);
-        break;
-    case IloAlgorithm::Feasible:
+        solution.gap = 0.0;
+        solution.objective_bound = static_cast<double>(solution.makespan);
+    } else if (solution_found)
+    {
         solution.solution_state = convert(MODEL_SOL_FEASIBLE);
-        break;
-    case IloAlgorithm::Infeasible:
+    } else if (search_completed)
+    {
         solution.solution_state = convert(MODEL_SOL_INFEASIBLE);
-        break;
-    case IloAlgorithm::Unbounded:
-        solution.solution_state = convert(MODEL_SOL_UNBOUNDED);
-        break;
-    case IloAlgorithm::InfeasibleOrUnbounded:
-        solution.solution_state = convert(MODEL_SOL_INFEASIBLE_OR_UNBOUNDED);
-        break;
-    case IloAlgorithm::Bounded:
-        solution.solution_state = convert(MODEL_SOL_BOUNDED);
-        break;
-    case IloAlgorithm::Error:
-        solution.solution_state = convert(MODEL_SOL_ERROR);
-        break;
-    case IloAlgorithm::Unknown:
+    } else
+    {
         solution.solution_state = convert(MODEL_SOL_UNKNOWN);
     }
 }
@@ -208,6 +676,7 @@ void CPSolver::set_solution(const IloCP &cp, Solution &solution) const
     solution.gap = cp.getObjGap();
     solution.objective_bound = cp.getObjBound();
     solution.runtime = cp.getInfo(IloCP::TotalTime);
+    solution.job_allocations.clear();
 
     size_t job_index = 0;
     for (const JobConstPtr &job : problem_instance.job_queue)
@@ -229,6 +698,4 @@ void CPSolver::set_solution(const IloCP &cp, Solution &solution) const
         solution.job_allocations.emplace_back(std::move(job_allocation));
         ++job_index;
     }
-
-    LOG_F(INFO, "Solution details updated successfully");
 }
@@ -0,0 +1,280 @@
+#include "Algorithms/GeneticAlgorithm/GeneticAlgorithm.hpp"
+#include "External/pempek_assert.hpp"
+#include "Settings.hpp"
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <thread>
+
+GeneticAlgorithm::Island::~Island()
+{
+    delete immigrant.load();
+}
+
+void GeneticAlgorithm::Island::send(const ScheduleEncoding &encoding)
+{
+    std::unique_ptr<ScheduleEncoding> replaced(immigrant.exchange(new ScheduleEncoding(encoding)));
+}
+
+std::unique_ptr<ScheduleEncoding> GeneticAlgorithm::Island::receive()
+{
+    return std::unique_ptr<ScheduleEncoding>(immigrant.exchange(nullptr));
+}
+
+GeneticAlgorithm::SearchState::SearchState(std::vector<IncumbentListener> listeners, size_t makespan_lower_bound,
+                                           size_t nb_islands, std::chrono::steady_clock::time_point deadline)
+    : deadline(deadline), islands(nb_islands), shared_incumbent(std::move(listeners), makespan_lower_bound)
+{}
+
+GeneticAlgorithm::GeneticAlgorithm(const ProblemInstance &problem_instance)
+    : problem_instance(problem_instance), precedence_graph(problem_instance),
+      makespan_lower_bound(
+          std::max(precedence_graph.compute_critical_path_length(), problem_instance.compute_energy_lower_bound()))
+{}
+
+void GeneticAlgorithm::add_incumbent_listener(IncumbentListener listener)
+{
+    incumbent_listeners.emplace_back(std::move(listener));
+}
+
+void GeneticAlgorithm::set_stop_token(std::stop_token stop_token) { this->stop_token = std::move(stop_token); }
+
+void GeneticAlgorithm::set_incumbent_source(const IncumbentStore &incumbent_store)
+{
+    incumbent_source = &incumbent_store;
+}
+
+void GeneticAlgorithm::set_seed(uint64_t seed) { random_seed = seed; }
+
+Solution GeneticAlgorithm::solve()
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                      std::chrono::duration<double>(Settings::Solver::MAX_RUNTIME));
+    const size_t nb_islands = Settings::Solver::GA_ISLANDS > 0 ? Settings::Solver::GA_ISLANDS
+                                                               : std::max<size_t>(Settings::Solver::NB_THREADS, 1);
+
+    SearchState search_state(incumbent_listeners, makespan_lower_bound, nb_islands, deadline);
+    {
+        std::vector<std::jthread> workers;
+        for (size_t island_index = 0; island_index < nb_islands; ++island_index)
+        {
+            workers.emplace_back([this, island_index, &search_state] {
+                try
+                {
+                    run_island(island_index, search_state);
+                } catch (...)
+                {
+                    std::scoped_lock lock(search_state.exception_mutex);
+                    if (!search_state.worker_exception)
+                    {
+                        search_state.worker_exception = std::current_exception();
+                    }
+                }
+            });
+        }
+    }
+
+    if (search_state.worker_exception)
+    {
+        std::rethrow_exception(search_state.worker_exception);
+    }
+
+    Solution solution;
+    solution.solver_configuration =
+        std::format("GeneticAlgorithm islands={} population={} generations={}", nb_islands,
+                    Settings::Solver::GA_POPULATION_SIZE, search_state.nb_generations.load());
+    solution.runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    search_state.shared_incumbent.complete_solution(solution);
+    return solution;
+}
+
+void GeneticAlgorithm::run_island(size_t island_index, SearchState &search_state) const
+{
+    ScheduleDecoder decoder(problem_instance);
+    RandomGenerator generator(random_seed, island_index);
+    const size_t population_size = Settings::Solver::GA_POPULATION_SIZE;
+    const size_t nb_islands = search_state.islands.size();
+
+    std::vector<ScheduleEncoding> population;
+    for (size_t index = 0; index < population_size; ++index)
+    {
+        population.emplace_back(make_random_encoding(decoder, generator));
+    }
+    evaluate(decoder, population);
+    std::ranges::sort(population, std::ranges::less{}, &ScheduleEncoding::makespan);
+    publish(search_state, decoder, population.front());
+    if (island_index == 0)
+    {
+        if (std::optional<ScheduleEncoding> imported =
+                import_incumbent(decoder, incumbent_source, search_state.shared_incumbent))
+        {
+            population.back() = std::move(*imported);
+        }
+    }
+
+    std::vector<ScheduleEncoding> offspring(population_size);
+    for (size_t generation = 1;; ++generation)
+    {
+        if (std::chrono::steady_clock::now() >= search_state.deadline || stop_token.stop_requested() ||
+            search_state.shared_incumbent.reached_lower_bound())
+        {
+            return;
+        }
+
+        // every pair of parents gives a daughter led by the mother and a son led by the father
+        for (size_t index = 0; index < population_size; index += 2)
+        {
+            const ScheduleEncoding &mother = select_parent(population, generator);
+            const ScheduleEncoding &father = select_parent(population, generator);
+            crossover(mother, father, generator, offspring[index]);
+            mutate(decoder, generator, offspring[index]);
+            if (index + 1 < population_size)
+            {
+                crossover(father, mother, generator, offspring[index + 1]);
+                mutate(decoder, generator, offspring[index + 1]);
+            }
+        }
+        evaluate(decoder, offspring);
+
+        // the best individuals of the parents and offspring survive, the others give back their buffers
+        population.insert(population.end(), std::make_move_iterator(offspring.begin()),
+                          std::make_move_iterator(offspring.end()));
+        std::ranges::stable_sort(population, std::ranges::less{}, &ScheduleEncoding::makespan);
+        std::ranges::move(population.begin() + static_cast<std::ptrdiff_t>(population_size), population.end(),
+                          offspring.begin());
+        population.resize(population_size);
+        search_state.nb_generations.fetch_add(1, std::memory_order_relaxed);
+
+        if (population.front().makespan < search_state.shared_incumbent.get_best_makespan())
+        {
+            publish(search_state, decoder, population.front());
+        }
+
+        if (generation % Settings::Solver::GA_MIGRATION_INTERVAL != 0)
+        {
+            continue;
+        }
+        if (nb_islands > 1)
+        {
+            search_state.islands[(island_index + 1) % nb_islands].send(population.front());
+            std::unique_ptr<ScheduleEncoding> immigrant = search_state.islands[island_index].receive();
+            if (immigrant && immigrant->makespan < population.back().makespan)
+            {
+                population.back() = std::move(*immigrant);
+            }
+        }
+        // the schedules of the other engines reach the other islands through the ring
+        if (island_index == 0)
+        {
+            if (std::optional<ScheduleEncoding> imported =
+                import_incumbent(decoder, incumbent_source, search_state.shared_incumbent))
+            {
+                population.back() = std::move(*imported);
+            }
+        }
+    }
+}
+
+void GeneticAlgorithm::evaluate(ScheduleDecoder &decoder, std::vector<ScheduleEncoding> &batch) const
+{
+    for (ScheduleEncoding &encoding : batch)
+    {
+        encoding.makespan = decoder.decode(encoding.activity_list, encoding.job_modes);
+    }
+}
+
+const ScheduleEncoding &GeneticAlgorithm::select_parent(const std::vector<ScheduleEncoding> &population,
+                                                        RandomGenerator &generator) const
+{
+    // binary tournament
+    const ScheduleEncoding &first = population[generator.uniform_index(population.size())];
+    const ScheduleEncoding &second = population[generator.uniform_index(population.size())];
+    return second.makespan < first.makespan ? second : first;
+}
+
+void GeneticAlgorithm::crossover(const ScheduleEncoding &mother, const ScheduleEncoding &father,
+                                 RandomGenerator &generator, ScheduleEncoding &child) const
+{
+    const size_t nb_jobs = mother.activity_list.size();
+    size_t first_cut = generator.uniform_index(nb_jobs + 1);
+    size_t second_cut = generator.uniform_index(nb_jobs + 1);
+    if (first_cut > second_cut)
+    {
+        std::swap(first_cut, second_cut);
+    }
+
+    // the mother gives the first positions, the father the middle ones and the mother the rest, every parent
+    // filling in its jobs not listed yet in its own order
+    std::vector<char> listed(nb_jobs, 0);
+    child.activity_list.assign(mother.activity_list.begin(),
+                               mother.activity_list.begin() + static_cast<std::ptrdiff_t>(first_cut));
+    for (size_t job_index : child.activity_list)
+    {
+        listed[job_index] = 1;
+    }
+    for (auto it = father.activity_list.begin(); child.activity_list.size() < second_cut; ++it)
+    {
+        if (!listed[*it])
+        {
+            listed[*it] = 1;
+            child.activity_list.emplace_back(*it);
+        }
+    }
+    for (size_t job_index : mother.activity_list)
+    {
+        if (!listed[job_index])
+        {
+            child.activity_list.emplace_back(job_index);
+        }
+    }
+
+    first_cut = generator.uniform_index(nb_jobs + 1);
+    second_cut = generator.uniform_index(nb_jobs + 1);
+    if (first_cut > second_cut)
+    {
+        std::swap(first_cut, second_cut);
+    }
+    child.job_modes = mother.job_modes;
+    std::copy(father.job_modes.begin() + static_cast<std::ptrdiff_t>(first_cut),
+              father.job_modes.begin() + static_cast<std::ptrdiff_t>(second_cut),
+              child.job_modes.begin() + static_cast<std::ptrdiff_t>(first_cut));
+}
+
+void GeneticAlgorithm::mutate(const ScheduleDecoder &decoder, RandomGenerator &generator,
+                              ScheduleEncoding &encoding) const
+{
+    const double mutation_probability = Settings::Solver::GA_MUTATION_PROBABILITY;
+    auto &activity_list = encoding.activity_list;
+    for (size_t position = 0; position + 1 < activity_list.size(); ++position)
+    {
+        // two neighbours can only be swapped when the second one is not a successor of the first one
+        const auto &successors = precedence_graph.get_successors(activity_list[position]);
+        if (generator.bernoulli(mutation_probability) &&
+            std::ranges::find(successors, activity_list[position + 1]) == successors.end())
+        {
+            std::swap(activity_list[position], activity_list[position + 1]);
+        }
+    }
+
+    bool modes_changed = false;
+    for (size_t job_index = 0; job_index < encoding.job_modes.size(); ++job_index)
+    {
+        if (generator.bernoulli(mutation_probability))
+        {
+            encoding.job_modes[job_index] = generator.uniform_index(decoder.get_nb_modes(job_index));
+            modes_changed = true;
+        }
+    }
+    if (modes_changed)
+    {
+        repair_modes(decoder, encoding.job_modes, generator);
+    }
+}
+
+void GeneticAlgorithm::publish(SearchState &search_state, ScheduleDecoder &decoder,
+                               const ScheduleEncoding &encoding) const
+{
+    decoder.decode(encoding.activity_list, encoding.job_modes);
+    search_state.shared_incumbent.offer(encoding.makespan, decoder.get_job_allocations(encoding.job_modes));
+}
@@ -84,15 +84,7 @@ void ConstraintModelBuilder::add_job_start_time_constraints(const TimeIndexedMod
 
     LOG_F(INFO, "%s started", source_location_to_string(loc).c_str());
 
-    for (const auto &job : this->problem_instance.job_queue)
-    {
-        double b = 0.0;
-        Operator op = Operator::LESS_EQUAL;
-        SparseMatrix<double>::Row row = {{get_value(s, job->id, loc), 1.0},
-                                         {get_value(p, job->id, loc), 1.0},
-                                         {get_value(cMax, std::to_string(1), loc), -1.0}};
-        add_constraint(row, op, b, "start_time_constraint");
-    }
+    add_makespan_constraints(s, p, cMax);
 
     for (const JobConstPtr &job : this->problem_instance.job_queue)
     {
@@ -153,12 +145,7 @@ void ConstraintModelBuilder::add_renewable_resource_constraints(const TimeIndexe
         {
             auto b = static_cast<double>(this->problem_instance.resources.at(k).units);
             Operator op = Operator::LESS_EQUAL;
-            SparseMatrix<double>::Row row;
-
-            for (const JobConstPtr &job : problem_instance.job_queue)
-            {
-                add_resource_constraints_helper(x, job, row, t, k);
-            }
+            SparseMatrix<double>::Row row = get_renewable_resource_row(x, t, k);
 
             add_constraint(row, op, b, "renewable_resource_constraint");
         }
@@ -167,6 +154,18 @@ void ConstraintModelBuilder::add_renewable_resource_constraints(const TimeIndexe
     LOG_F(INFO, "%s finished successfully", source_location_to_string(loc).c_str());
 }
 
+SparseMatrix<double>::Row
+ConstraintModelBuilder::get_renewable_resource_row(const TimeIndexedModelVariableMapping::map3to1 &x, size_t t,
+                                                   size_t k) const
+{
+    SparseMatrix<double>::Row row;
+    for (const JobConstPtr &job : problem_instance.job_queue)
+    {
+        add_resource_constraints_helper(x, job, row, t, k);
+    }
+    return row;
+}
+
 void ConstraintModelBuilder::add_resource_constraints_helper(const TimeIndexedModelVariableMapping::map3to1 &x,
                                                              const JobConstPtr &job, SparseMatrix<double>::Row &row,
                                                              size_t t, size_t k) const
@@ -188,6 +187,420 @@ void ConstraintModelBuilder::add_resource_constraints_helper(const TimeIndexedMo
     }
 }
 
+void ConstraintModelBuilder::add_makespan_constraints(const TimeIndexedModelVariableMapping::map1to1 &s,
+                                                      const TimeIndexedModelVariableMapping::map1to1 &p,
+                                                      const TimeIndexedModelVariableMapping::map1to1 &cMax)
+{
+    const std::source_location loc = std::source_location::current();
+
+    for (const auto &job : this->problem_instance.job_queue)
+    {
+        double b = 0.0;
+        Operator op = Operator::LESS_EQUAL;
+        SparseMatrix<double>::Row row = {{get_value(s, job->id, loc), 1.0},
+                                         {get_value(p, job->id, loc), 1.0},
+                                         {get_value(cMax, std::to_string(1), loc), -1.0}};
+        add_constraint(row, op, b, "start_time_constraint");
+    }
+}
+
+void ConstraintModelBuilder::add_mode_selection_constraints(const TimeIndexedModelVariableMapping::map3to1 &mu,
+                                                            const TimeIndexedModelVariableMapping::map1to1 &p)
+{
+    const std::source_location loc = std::source_location::current();
+
+    LOG_F(INFO, "%s started", source_location_to_string(loc).c_str());
+
+    for (const JobConstPtr &job : this->problem_instance.job_queue)
+    {
+        SparseMatrix<double>::Row selection_row;
+        SparseMatrix<double>::Row processing_time_row;
+        size_t mode_id = 1;
+        for (const auto &mode : job->modes)
+        {
+            size_t idx = get_value(mu, {job->id, std::to_string(mode_id), std::to_string(0)}, loc);
+            selection_row.emplace_back(idx, 1.0);
+            processing_time_row.emplace_back(idx, mode.processing_time);
+            ++mode_id;
+        }
+        processing_time_row.emplace_back(get_value(p, job->id, loc), -1.0);
+
+        add_constraint(selection_row, Operator::EQUAL, 1.0, "mode_selection_constraint");
+        add_constraint(processing_time_row, Operator::EQUAL, 0.0, "processing_time_constraint");
+    }
+
+    LOG_F(INFO, "%s finished successfully", source_location_to_string(loc).c_str());
+}
+
+// x_{j,m,t} = 1 if job j was started in mode m at or before t
+void ConstraintModelBuilder::add_step_start_time_constraints(const TimeIndexedModelVariableMapping::map3to1 &x,
+                                                             const TimeIndexedModelVariableMapping::map3to1 &mu,
+                                                             const TimeIndexedModelVariableMapping::map1to1 &s)
+{
+    const std::source_location loc = std::source_location::current();
+
+    LOG_F(INFO, "%s started", source_location_to_string(loc).c_str());
+
+    const size_t horizon = problem_instance.makespan_upper_bound;
+
+    for (const JobConstPtr &job : this->problem_instance.job_queue)
+    {
+        SparseMatrix<double>::Row start_time_row;
+        for (size_t mode_id = 1; mode_id <= job->modes.size(); ++mode_id)
+        {
+            for (size_t t = 1; t < horizon; ++t)
+            {
+                SparseMatrix<double>::Row row = {
+                    {get_value(x, {job->id, std::to_string(mode_id), std::to_string(t - 1)}, loc), 1.0},
+                    {get_value(x, {job->id, std::to_string(mode_id), std::to_string(t)}, loc), -1.0}};
+                add_constraint(row, Operator::LESS_EQUAL, 0.0, "step_monotonicity_constraint");
+            }
+
+            SparseMatrix<double>::Row mode_row = {
+                {get_value(x, {job->id, std::to_string(mode_id), std::to_string(horizon - 1)}, loc), 1.0},
+                {get_value(mu, {job->id, std::to_string(mode_id), std::to_string(0)}, loc), -1.0}};
+            add_constraint(mode_row, Operator::EQUAL, 0.0, "step_mode_constraint");
+
+            for (size_t t = 0; t < horizon; ++t)
+            {
+                start_time_row.emplace_back(
+                    get_value(x, {job->id, std::to_string(mode_id), std::to_string(t)}, loc), 1.0);
+            }
+        }
+
+        // a job started at t0 has horizon - t0 variables set to one
+        start_time_row.emplace_back(get_value(s, job->id, loc), 1.0);
+        add_constraint(start_time_row, Operator::EQUAL, static_cast<double>(horizon), "start_time_constraint");
+    }
+
+    LOG_F(INFO, "%s finished successfully", source_location_to_string(loc).c_str());
+}
+
+void ConstraintModelBuilder::add_step_renewable_resource_constraints(const TimeIndexedModelVariableMapping::map3to1 &x)
+{
+    const std::source_location loc = std::source_location::current();
+
+    LOG_F(INFO, "%s started", source_location_to_string(loc).c_str());
+
+    const size_t nb_resources = problem_instance.resources.size();
+
+    for (size_t t = 0; t < problem_instance.makespan_upper_bound; ++t)
+    {
+        for (size_t k = 0; k < nb_resources; ++k)
+        {
+            SparseMatrix<double>::Row row;
+            for (const JobConstPtr &job : problem_instance.job_queue)
+            {
+                size_t mode_id = 1;
+                for (const auto &mode : job->modes)
+                {
+                    auto units = static_cast<double>(mode.requested_resources.at(k).units);
+                    if (units > 0.0)
+                    {
+                        row.emplace_back(get_value(x, {job->id, std::to_string(mode_id), std::to_string(t)}, loc),
+                                         units);
+                        if (t >= mode.processing_time)
+                        {
+                            row.emplace_back(get_value(x,
+                                                       {job->id, std::to_string(mode_id),
+                                                        std::to_string(t - mode.processing_time)},
+                                                       loc),
+                                             -units);
+                        }
+                    }
+                    ++mode_id;
+                }
+            }
+
+            if (!row.empty())
+            {
+                add_constraint(row, Operator::LESS_EQUAL,
+                               static_cast<double>(this->problem_instance.resources.at(k).units),
+                               "renewable_resource_constraint");
+            }
+        }
+    }
+
+    LOG_F(INFO, "%s finished successfully", source_location_to_string(loc).c_str());
+}
+
+// a successor started at or before t forces its predecessor to finish at or before t
+void ConstraintModelBuilder::add_disaggregated_precedence_constraints(const TimeIndexedModelVariableMapping::map3to1 &x)
+{
+    const std::source_location loc = std::source_location::current();
+
+    LOG_F(INFO, "%s started", source_location_to_string(loc).c_str());
+
+    const size_t horizon = problem_instance.makespan_upper_bound;
+
+    for (const JobConstPtr &job : this->problem_instance.job_queue)
+    {
+        for (const auto &succ : job->successors)
+        {
+            const JobConstPtr succ_job = problem_instance.find_job(succ);
+            PPK_ASSERT_ERROR(succ_job, "successor job %s was not found", succ.c_str());
+
+            for (size_t t = 0; t < horizon; ++t)
+            {
+                SparseMatrix<double>::Row row;
+                size_t mode_id = 1;
+                for (const auto &mode : job->modes)
+                {
+                    size_t first_start = (t + 1 >= mode.processing_time) ? t + 1 - mode.processing_time : 0;
+                    for (size_t tau = first_start; tau < horizon; ++tau)
+                    {
+                        row.emplace_back(
+                            get_value(x, {job->id, std::to_string(mode_id), std::to_string(tau)}, loc), 1.0);
+                    }
+                    ++mode_id;
+                }
+
+                for (size_t succ_mode_id = 1; succ_mode_id <= succ_job->modes.size(); ++succ_mode_id)
+                {
+                    for (size_t tau = 0; tau <= t; ++tau)
+                    {
+                        row.emplace_back(
+                            get_value(x, {succ_job->id, std::to_string(succ_mode_id), std::to_string(tau)}, loc),
+                            1.0);
+                    }
+                }
+                add_constraint(row, Operator::LESS_EQUAL, 1.0, "precedence_constraint");
+            }
+        }
+    }
+
+    LOG_F(INFO, "%s finished successfully", source_location_to_string(loc).c_str());
+}
+
+// on/off event formulation: z_{j,m,e} = 1 if job j runs in mode m right after event e
+void ConstraintModelBuilder::add_event_sequence_constraints(const TimeIndexedModelVariableMapping::map3to1 &z,
+                                                            const TimeIndexedModelVariableMapping::map3to1 &mu,
+                                                            const TimeIndexedModelVariableMapping::map1to1 &tau)
+{
+    const std::source_location loc = std::source_location::current();
+
+    LOG_F(INFO, "%s started", source_location_to_string(loc).c_str());
+
+    const auto nb_events = static_cast<long>(problem_instance.job_queue.nb_elements());
+
+    for (long e = 0; e + 1 < nb_events; ++e)
+    {
+        SparseMatrix<double>::Row row = {{get_value(tau, std::to_string(e), loc), 1.0},
+                                         {get_value(tau, std::to_string(e + 1), loc), -1.0}};
+        add_constraint(row, Operator::LESS_EQUAL, 0.0, "event_order_constraint");
+    }
+
+    for (const JobConstPtr &job : this->problem_instance.job_queue)
+    {
+        for (long e = 0; e < nb_events; ++e)
+        {
+            for (size_t mode_id = 1; mode_id <= job->modes.size(); ++mode_id)
+            {
+                SparseMatrix<double>::Row row = {
+                    {get_value(z, {job->id, std::to_string(mode_id), std::to_string(e)}, loc), 1.0},
+                    {get_value(mu, {job->id, std::to_string(mode_id), std::to_string(0)}, loc), -1.0}};
+                add_constraint(row, Operator::LESS_EQUAL, 0.0, "event_mode_constraint");
+            }
+        }
+
+        SparseMatrix<double>::Row processed_row;
+        for (long e = 0; e < nb_events; ++e)
+        {
+            add_event_terms_helper(z, job, processed_row, e, 1.0);
+        }
+        add_constraint(processed_row, Operator::GREATER_EQUAL, 1.0, "event_processing_constraint");
+
+        // non-preemption: the events at which a job is in process are contiguous
+        for (long e = 1; e < nb_events; ++e)
+        {
+            const auto before = static_cast<double>(e);
+            const auto after = static_cast<double>(nb_events - e);
+
+            SparseMatrix<double>::Row before_row;
+            for (long f = 0; f < e; ++f)
+            {
+                add_event_terms_helper(z, job, before_row, f, 1.0);
+            }
+            add_event_terms_helper(z, job, before_row, e, before);
+            add_event_terms_helper(z, job, before_row, e - 1, -before);
+            merge_row_elements(before_row);
+            add_constraint(before_row, Operator::LESS_EQUAL, before, "event_contiguity_constraint");
+
+            SparseMatrix<double>::Row after_row;
+            for (long f = e; f < nb_events; ++f)
+            {
+                add_event_terms_helper(z, job, after_row, f, 1.0);
+            }
+            add_event_terms_helper(z, job, after_row, e, -after);
+            add_event_terms_helper(z, job, after_row, e - 1, after);
+            merge_row_elements(after_row);
+            add_constraint(after_row, Operator::LESS_EQUAL, after, "event_contiguity_constraint");
+        }
+    }
+
+    LOG_F(INFO, "%s finished successfully", source_location_to_string(loc).c_str());
+}
+
+void ConstraintModelBuilder::add_event_start_time_constraints(const TimeIndexedModelVariableMapping::map3to1 &z,
+                                                              const TimeIndexedModelVariableMapping::map1to1 &tau,
+                                                              const TimeIndexedModelVariableMapping::map1to1 &s,
+                                                              const TimeIndexedModelVariableMapping::map1to1 &p)
+{
+    const std::source_location loc = std::source_location::current();
+
+    LOG_F(INFO, "%s started", source_location_to_string(loc).c_str());
+
+    const auto nb_events = static_cast<long>(problem_instance.job_queue.nb_elements());
+    const auto horizon = static_cast<double>(problem_instance.makespan_upper_bound);
+
+    for (const JobConstPtr &job : this->problem_instance.job_queue)
+    {
+        const auto max_processing_time = static_cast<double>(
+            std::ranges::max(job->modes, std::ranges::less{}, &Mode::processing_time).processing_time);
+        size_t s_idx = get_value(s, job->id, loc);
+        size_t p_idx = get_value(p, job->id, loc);
+
+        for (long e = 0; e < nb_events; ++e)
+        {
+            size_t tau_idx = get_value(tau, std::to_string(e), loc);
+
+            // s_j equals the date of the event at which the job starts
+            SparseMatrix<double>::Row upper_row = {{s_idx, 1.0}, {tau_idx, -1.0}};
+            add_event_terms_helper(z, job, upper_row, e, horizon);
+            add_event_terms_helper(z, job, upper_row, e - 1, -horizon);
+            add_constraint(upper_row, Operator::LESS_EQUAL, horizon, "event_start_time_constraint");
+
+            SparseMatrix<double>::Row lower_row = {{tau_idx, 1.0}, {s_idx, -1.0}};
+            add_event_terms_helper(z, job, lower_row, e, horizon);
+            add_event_terms_helper(z, job, lower_row, e - 1, -horizon);
+            add_constraint(lower_row, Operator::LESS_EQUAL, horizon, "event_start_time_constraint");
+
+            // a job started at event e and finished at event f is processed between both event dates
+            for (long f = e + 1; f < nb_events; ++f)
+            {
+                SparseMatrix<double>::Row row = {
+                    {get_value(tau, std::to_string(f), loc), 1.0}, {tau_idx, -1.0}, {p_idx, -1.0}};
+                add_event_terms_helper(z, job, row, e, -max_processing_time);
+                add_event_terms_helper(z, job, row, e - 1, max_processing_time);
+                add_event_terms_helper(z, job, row, f, max_processing_time);
+                add_event_terms_helper(z, job, row, f - 1, -max_processing_time);
+                merge_row_elements(row);
+                add_constraint(row, Operator::GREATER_EQUAL, -2.0 * max_processing_time, "event_duration_constraint");
+            }
+        }
+    }
+
+    LOG_F(INFO, "%s finished successfully", source_location_to_string(loc).c_str());
+}
+
+void ConstraintModelBuilder::add_event_precedence_constraints(const TimeIndexedModelVariableMapping::map3to1 &z)
+{
+    const std::source_location loc = std::source_location::current();
+
+    LOG_F(INFO, "%s started", source_location_to_string(loc).c_str());
+
+    const auto nb_events = static_cast<long>(problem_instance.job_queue.nb_elements());
+
+    for (const JobConstPtr &job : this->problem_instance.job_queue)
+    {
+        for (const auto &succ : job->successors)
+        {
+            const JobConstPtr succ_job = problem_instance.find_job(succ);
+            PPK_ASSERT_ERROR(succ_job, "successor job %s was not found", succ.c_str());
+
+            for (long e = 0; e < nb_events; ++e)
+            {
+                SparseMatrix<double>::Row row;
+                add_event_terms_helper(z, job, row, e, static_cast<double>(e + 1));
+                for (long f = 0; f <= e; ++f)
+                {
+                    add_event_terms_helper(z, succ_job, row, f, 1.0);
+                }
+                add_constraint(row, Operator::LESS_EQUAL, static_cast<double>(e + 1), "precedence_constraint");
+            }
+        }
+    }
+
+    LOG_F(INFO, "%s finished successfully", source_location_to_string(loc).c_str());
+}
+
+void ConstraintModelBuilder::add_event_renewable_resource_constraints(const TimeIndexedModelVariableMapping::map3to1 &z)
+{
+    const std::source_location loc = std::source_location::current();
+
+    LOG_F(INFO, "%s started", source_location_to_string(loc).c_str());
+
+    const size_t nb_events = problem_instance.job_queue.nb_elements();
+    const size_t nb_resources = problem_instance.resources.size();
+
+    for (size_t e = 0; e < nb_events; ++e)
+    {
+        for (size_t k = 0; k < nb_resources; ++k)
+        {
+            SparseMatrix<double>::Row row;
+            for (const JobConstPtr &job : problem_instance.job_queue)
+            {
+                size_t mode_id = 1;
+                for (const auto &mode : job->modes)
+                {
+                    if (size_t units = mode.requested_resources.at(k).units; units > 0)
+                    {
+                        row.emplace_back(get_value(z, {job->id, std::to_string(mode_id), std::to_string(e)}, loc),
+                                         static_cast<double>(units));
+                    }
+                    ++mode_id;
+                }
+            }
+
+            if (!row.empty())
+            {
+                add_constraint(row, Operator::LESS_EQUAL,
+                               static_cast<double>(this->problem_instance.resources.at(k).units),
+                               "renewable_resource_constraint");
+            }
+        }
+    }
+
+    LOG_F(INFO, "%s finished successfully", source_location_to_string(loc).c_str());
+}
+
+void ConstraintModelBuilder::add_event_terms_helper(const TimeIndexedModelVariableMapping::map3to1 &z,
+                                                    const JobConstPtr &job, SparseMatrix<double>::Row &row, long e,
+                                                    double coefficient) const
+{
+    const std::source_location loc = std::source_location::current();
+
+    if (e < 0)
+    {
+        return;
+    }
+
+    for (size_t mode_id = 1; mode_id <= job->modes.size(); ++mode_id)
+    {
+        row.emplace_back(get_value(z, {job->id, std::to_string(mode_id), std::to_string(e)}, loc), coefficient);
+    }
+}
+
+void ConstraintModelBuilder::merge_row_elements(SparseMatrix<double>::Row &row) const
+{
+    std::ranges::sort(row, std::ranges::less{}, &std::pair<size_t, double>::first);
+
+    SparseMatrix<double>::Row merged_row;
+    merged_row.reserve(row.size());
+    for (const auto &[index, value] : row)
+    {
+        if (!merged_row.empty() && merged_row.back().first == index)
+        {
+            merged_row.back().second += value;
+        } else
+        {
+            merged_row.emplace_back(index, value);
+        }
+    }
+    std::erase_if(merged_row, [](const auto &element) { return element.second == 0.0; });
+    row = std::move(merged_row);
+}
+
 void ConstraintModelBuilder::add_constraint(SparseMatrix<double>::Row &row, Operator op, const double &b,
                                             const std::string &con_desc)
 {
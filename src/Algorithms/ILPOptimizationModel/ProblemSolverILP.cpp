@@ -5,34 +5,69 @@
 #include "loguru.hpp"
 #include <chrono>
 #include <cmath>
+#include <filesystem>
+#include <format>
+#include <limits>
 #include <memory>
+#include <random>
+#include <string_view>
+#include <unordered_map>
 
-ProblemSolverILP::ProblemSolverILP(const ProblemInstance &problem_instance) : variable_mapping_ilp(problem_instance)
+ProblemSolverILP::ProblemSolverILP(const ProblemInstance &problem_instance)
+    : problem_instance(problem_instance), variable_mapping_ilp(problem_instance)
 {
-    ConstraintModelBuilder constraint_model_builder(problem_instance);
-    construct(constraint_model_builder);
+    construct(problem_instance);
 }
 
-Solution ProblemSolverILP::solve(Solution &init_solution, double rel_gap, double time_limit) const
+Solution ProblemSolverILP::solve(const Solution &init_solution, double rel_gap, double time_limit) const
 {
 
     Solution solution;
     SolutionILP solution_ilp;
     std::unique_ptr<Solver> solver = nullptr;
-    PPK_ASSERT_ERROR(Settings::Solver::USE_GUROBI, "Solver was not selected");
 
+#ifdef MRCPSP_HAS_GUROBI
     solver = std::make_unique<GurobiSolver>();
+#endif
+    PPK_ASSERT_ERROR(solver != nullptr, "No ILP solver is available in this build");
+    solver->set_stop_token(stop_token);
 
-    solver->initialize_local_environments(1u);
+    if (Settings::Solver::ILP_LAZY_RESOURCE_CONSTRAINTS)
+    {
+        solver->set_lazy_constraint_generator(
+            [this](const std::vector<double> &solution) { return separate_renewable_resource_constraints(solution); });
+    }
+
+    IncumbentPublisher incumbent_publisher(incumbent_listeners);
+    if (incumbent_publisher.has_listeners())
+    {
+        solver->set_incumbent_callback(
+            [this, &incumbent_publisher](const std::vector<double> &solution, double objective, double bound) {
+                const auto makespan = static_cast<size_t>(std::lround(objective));
+                if (incumbent_publisher.improves(makespan))
+                {
+                    incumbent_publisher.publish(makespan, bound, get_job_allocations(presolver.postsolve(solution)));
+                }
+            });
+    }
+
+    std::vector<double> start_values;
+    if (Settings::Solver::INIT_ILP_SOLUTION && !init_solution.job_allocations.empty())
+    {
+        start_values = get_start_values(init_solution.job_allocations);
+    }
 
     std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
 
-    solution_ilp = solver->solve_ilp(init_solution, ilp_model, Settings::Solver::VERBOSE, rel_gap, time_limit,
-                                     Settings::Solver::NB_THREADS, 0);
+    solution_ilp = solver->solve_ilp(start_values, ilp_model, Settings::Solver::VERBOSE, rel_gap, time_limit,
+                                     Settings::Solver::NB_THREADS);
 
     using chrono_clk = std::chrono::high_resolution_clock;
     solution.runtime = duration_cast<std::chrono::duration<double>>(chrono_clk::now() - start).count();
     solution.solution_state = convert(solution_ilp.status);
+    solution.solver_configuration =
+        std::format("{} threads={} formulation={}{}", solver->get_solver_identification(), Settings::Solver::NB_THREADS,
+                    Settings::Solver::ILP_FORMULATION, Settings::Solver::ILP_LAZY_RESOURCE_CONSTRAINTS ? " lazy" : "");
 
     if (solution_ilp.status == MODEL_STATUS::MODEL_SOL_OPTIMAL ||
         solution_ilp.status == MODEL_STATUS::MODEL_SOL_FEASIBLE)
@@ -41,20 +76,8 @@ Solution ProblemSolverILP::solve(Solution &init_solution, double rel_gap, double
         {
             solution.makespan = static_cast<size_t>(std::round(solution_ilp.criterion));
             solution.gap = solution_ilp.gap;
-            auto job_start_times = lookup(solution_ilp.solution, variable_mapping_ilp.s);
-            auto job_durations = lookup(solution_ilp.solution, variable_mapping_ilp.p);
-            auto job_modes = lookup(solution_ilp.solution, variable_mapping_ilp.x);
-
-            for (const auto &[job_id, start_time] : job_start_times)
-            {
-                JobAllocation job_allocation;
-                job_allocation.job_id = job_id;
-                job_allocation.start_time = start_time;
-                job_allocation.duration = job_durations[job_id];
-                job_allocation.mode_id = job_modes[job_id];
-
-                solution.job_allocations.emplace_back(std::move(job_allocation));
-            }
+            solution.objective_bound = solution_ilp.bound;
+            solution.job_allocations = get_job_allocations(presolver.postsolve(solution_ilp.solution));
         } catch (...)
         {
             throw_with_nested(CustomException(std::source_location::current(),
@@ -64,7 +87,109 @@ Solution ProblemSolverILP::solve(Solution &init_solution, double rel_gap, double
     return solution;
 }
 
-void ProblemSolverILP::construct(ConstraintModelBuilder &constraint_model_builder)
+void ProblemSolverILP::add_incumbent_listener(IncumbentListener listener)
+{
+    incumbent_listeners.emplace_back(std::move(listener));
+}
+
+void ProblemSolverILP::set_stop_token(std::stop_token stop_token) { this->stop_token = std::move(stop_token); }
+
+const std::map<std::string, ProblemSolverILP::FormulationBuilder, std::less<>> &
+ProblemSolverILP::get_formulation_registry()
+{
+    static const std::map<std::string, FormulationBuilder, std::less<>> registry = {
+        {"pulse",
+         {&ProblemSolverILP::add_pulse_formulation_variables, &ProblemSolverILP::construct_pulse_formulation, true}},
+        {"step",
+         {&ProblemSolverILP::add_step_formulation_variables, &ProblemSolverILP::construct_step_formulation, false}},
+        {"disaggregated",
+         {&ProblemSolverILP::add_pulse_formulation_variables, &ProblemSolverILP::construct_disaggregated_formulation,
+          true}},
+        {"event",
+         {&ProblemSolverILP::add_event_formulation_variables, &ProblemSolverILP::construct_event_formulation, false}}};
+    return registry;
+}
+
+void ProblemSolverILP::construct(const ProblemInstance &problem_instance)
+{
+    const auto &registry = get_formulation_registry();
+    auto it = registry.find(Settings::Solver::ILP_FORMULATION);
+    PPK_ASSERT_ERROR(it != registry.end(), "Unknown ILP formulation %s", Settings::Solver::ILP_FORMULATION.c_str());
+    const FormulationBuilder &formulation_builder = it->second;
+    PPK_ASSERT_ERROR(!Settings::Solver::ILP_LAZY_RESOURCE_CONSTRAINTS ||
+                         formulation_builder.supports_lazy_resource_constraints,
+                     "The %s formulation does not support lazy resource constraints", it->first.c_str());
+
+    // the variable mapping is always rebuilt since it is needed to map the solution back to the jobs
+    std::invoke(formulation_builder.add_variables, this);
+    const size_t nb_variables = variable_mapping_ilp.get_nb_variables();
+
+    // instance files of different sets share their names, the fingerprint of the contents tells them apart, and the
+    // model name records it with the size of the model so that a cached model is only used for its own instance
+    std::filesystem::path cache_path;
+    const uint64_t fingerprint = problem_instance.compute_fingerprint();
+    auto get_model_name = [fingerprint](const ILPSolverModel &model) {
+        return std::format("MRCPSP_{:016x}_{}_{}_{}", fingerprint, model.get_nb_variables(),
+                           model.get_nb_constraints(), model.matrix_A.get_nb_elements());
+    };
+    if (!Settings::Solver::ILP_MODEL_CACHE_DIRECTORY.empty())
+    {
+        const std::string instance_name = std::filesystem::path(problem_instance.get_name()).stem().string();
+        cache_path = std::filesystem::path(Settings::Solver::ILP_MODEL_CACHE_DIRECTORY) /
+                     std::format("{}_{}{}_{:016x}.mps.gz", instance_name, it->first,
+                                 Settings::Solver::ILP_LAZY_RESOURCE_CONSTRAINTS ? "_lazy" : "", fingerprint);
+    }
+
+    if (!cache_path.empty() && std::filesystem::exists(cache_path))
+    {
+        ilp_model.read_mps(cache_path.string());
+        PPK_ASSERT_ERROR(ilp_model.get_nb_variables() == nb_variables && ilp_model.name == get_model_name(ilp_model),
+                         "Cached ILP model %s does not match the instance, remove it", cache_path.string().c_str());
+    } else
+    {
+        ConstraintModelBuilder constraint_model_builder(problem_instance);
+        std::invoke(formulation_builder.add_constraints, this, constraint_model_builder);
+
+        ilp_model.vector_c.resize(nb_variables, 0.0);
+        ilp_model.vector_c[0] = 1;
+
+        ilp_model.vector_x = move(variable_mapping_ilp.variables);
+        ilp_model.varDesc = move(variable_mapping_ilp.var_desc);
+        constraint_model_builder.move_constraints_to_model(ilp_model);
+
+        if (!cache_path.empty())
+        {
+            // the model is written to a file of its own and renamed onto the cache file, so that a run reading the
+            // cache never sees a partially written model of an interrupted or concurrent run
+            std::filesystem::create_directories(cache_path.parent_path());
+            std::random_device random_device;
+            std::filesystem::path temporary_path = cache_path;
+            temporary_path.replace_filename(std::format("{}.{:08x}{:08x}.tmp.gz", cache_path.filename().string(),
+                                                        random_device(), random_device()));
+            ilp_model.name = get_model_name(ilp_model);
+            ilp_model.write_mps(temporary_path.string());
+            std::filesystem::rename(temporary_path, cache_path);
+        }
+    }
+
+    if (Settings::Solver::ILP_PRESOLVE)
+    {
+        presolve();
+    }
+
+    if (Settings::Solver::VERBOSE == true)
+    {
+        ilp_model.log_statistics();
+    }
+}
+
+// x_{j,m,t} = 1 if job j starts at t in mode m
+void ProblemSolverILP::add_pulse_formulation_variables()
+{
+    variable_mapping_ilp.add_jobs_start_time_binary_variables();
+}
+
+void ProblemSolverILP::construct_pulse_formulation(ConstraintModelBuilder &constraint_model_builder)
 {
     constraint_model_builder.add_job_processing_time_constraints(variable_mapping_ilp.x, variable_mapping_ilp.p);
 
@@ -73,17 +198,235 @@ void ProblemSolverILP::construct(ConstraintModelBuilder &constraint_model_builde
 
     constraint_model_builder.add_precedence_constraints(variable_mapping_ilp.s, variable_mapping_ilp.p);
 
-    constraint_model_builder.add_renewable_resource_constraints(variable_mapping_ilp.x);
+    if (!Settings::Solver::ILP_LAZY_RESOURCE_CONSTRAINTS)
+    {
+        constraint_model_builder.add_renewable_resource_constraints(variable_mapping_ilp.x);
+    }
+}
+
+// x_{j,m,t} = 1 if job j was started in mode m at or before t
+void ProblemSolverILP::add_step_formulation_variables()
+{
+    variable_mapping_ilp.add_jobs_start_time_binary_variables();
+    variable_mapping_ilp.add_jobs_mode_variables();
+}
+
+void ProblemSolverILP::construct_step_formulation(ConstraintModelBuilder &constraint_model_builder)
+{
+    constraint_model_builder.add_mode_selection_constraints(variable_mapping_ilp.mu, variable_mapping_ilp.p);
+
+    constraint_model_builder.add_step_start_time_constraints(variable_mapping_ilp.x, variable_mapping_ilp.mu,
+                                                             variable_mapping_ilp.s);
+
+    constraint_model_builder.add_makespan_constraints(variable_mapping_ilp.s, variable_mapping_ilp.p,
+                                                      variable_mapping_ilp.c_max);
+
+    constraint_model_builder.add_precedence_constraints(variable_mapping_ilp.s, variable_mapping_ilp.p);
+
+    constraint_model_builder.add_step_renewable_resource_constraints(variable_mapping_ilp.x);
+}
+
+// pulse variables with one precedence row per edge and time period, tighter LP relaxation
+void ProblemSolverILP::construct_disaggregated_formulation(ConstraintModelBuilder &constraint_model_builder)
+{
+    constraint_model_builder.add_job_processing_time_constraints(variable_mapping_ilp.x, variable_mapping_ilp.p);
+
+    constraint_model_builder.add_job_start_time_constraints(variable_mapping_ilp.s, variable_mapping_ilp.x,
+                                                            variable_mapping_ilp.p, variable_mapping_ilp.c_max);
 
-    ilp_model.vector_c.resize(variable_mapping_ilp.get_nb_variables(), 0.0);
-    ilp_model.vector_c[0] = 1;
+    constraint_model_builder.add_disaggregated_precedence_constraints(variable_mapping_ilp.x);
 
-    ilp_model.vector_x = move(variable_mapping_ilp.variables);
-    ilp_model.varDesc = move(variable_mapping_ilp.var_desc);
-    constraint_model_builder.move_constraints_to_model(ilp_model);
+    if (!Settings::Solver::ILP_LAZY_RESOURCE_CONSTRAINTS)
+    {
+        constraint_model_builder.add_renewable_resource_constraints(variable_mapping_ilp.x);
+    }
+}
+
+// on/off events, the model size does not depend on the time horizon
+void ProblemSolverILP::add_event_formulation_variables()
+{
+    variable_mapping_ilp.add_jobs_mode_variables();
+    variable_mapping_ilp.add_event_variables();
+}
+
+void ProblemSolverILP::construct_event_formulation(ConstraintModelBuilder &constraint_model_builder)
+{
+    constraint_model_builder.add_mode_selection_constraints(variable_mapping_ilp.mu, variable_mapping_ilp.p);
+
+    constraint_model_builder.add_event_sequence_constraints(variable_mapping_ilp.z, variable_mapping_ilp.mu,
+                                                            variable_mapping_ilp.tau);
+
+    constraint_model_builder.add_event_start_time_constraints(variable_mapping_ilp.z, variable_mapping_ilp.tau,
+                                                              variable_mapping_ilp.s, variable_mapping_ilp.p);
+
+    constraint_model_builder.add_makespan_constraints(variable_mapping_ilp.s, variable_mapping_ilp.p,
+                                                      variable_mapping_ilp.c_max);
+
+    constraint_model_builder.add_event_precedence_constraints(variable_mapping_ilp.z);
+
+    constraint_model_builder.add_event_renewable_resource_constraints(variable_mapping_ilp.z);
+}
+
+void ProblemSolverILP::presolve()
+{
+    // time windows only apply to the time-indexed formulations
+    if (!variable_mapping_ilp.x.empty())
+    {
+        const bool cumulative = !variable_mapping_ilp.mu.empty();
+        for (size_t index : variable_mapping_ilp.get_out_of_window_start_time_variables(cumulative))
+        {
+            presolver.fix_variable(index, 0.0);
+        }
+    }
+
+    presolver.presolve(ilp_model);
 
     if (Settings::Solver::VERBOSE == true)
     {
-        ilp_model.log_statistics();
+        presolver.log_statistics();
+    }
+}
+
+// resource rows of the pulse formulations violated by the schedule, expressed in the variables of the reduced model
+std::vector<LazyConstraint> ProblemSolverILP::separate_renewable_resource_constraints(
+    const std::vector<double> &solution) const
+{
+    const std::vector<double> values = presolver.postsolve(solution);
+    const size_t horizon = problem_instance.makespan_upper_bound;
+    const size_t nb_resources = problem_instance.resources.size();
+
+    // resource profiles as difference arrays over the horizon
+    std::vector<std::vector<long>> profiles(nb_resources, std::vector<long>(horizon + 1, 0));
+    for (const auto &block : variable_mapping_ilp.get_job_variable_blocks())
+    {
+        const size_t nb_modes = block.job->modes.size();
+        for (size_t index = block.first_mode_variable; index < block.last_mode_variable; ++index)
+        {
+            if (values[index] > 0.5)
+            {
+                const Mode &mode = block.job->modes[(index - block.first_mode_variable) % nb_modes];
+                const size_t start = (index - block.first_mode_variable) / nb_modes;
+                const size_t end = std::min(start + mode.processing_time, horizon);
+                for (size_t k = 0; k < nb_resources; ++k)
+                {
+                    profiles[k][start] += static_cast<long>(mode.requested_resources.at(k).units);
+                    profiles[k][end] -= static_cast<long>(mode.requested_resources.at(k).units);
+                }
+            }
+        }
+    }
+
+    ConstraintModelBuilder constraint_model_builder(problem_instance);
+    std::vector<LazyConstraint> lazy_constraints;
+    for (size_t k = 0; k < nb_resources; ++k)
+    {
+        const auto capacity = static_cast<long>(problem_instance.resources.at(k).units);
+        long usage = 0;
+        for (size_t t = 0; t < horizon; ++t)
+        {
+            usage += profiles[k][t];
+            if (usage > capacity)
+            {
+                LazyConstraint lazy_constraint{constraint_model_builder.get_renewable_resource_row(
+                                                   variable_mapping_ilp.x, t, k),
+                                               Operator::LESS_EQUAL, static_cast<double>(capacity)};
+                presolver.reduce_row(lazy_constraint.row, lazy_constraint.b);
+                lazy_constraints.emplace_back(std::move(lazy_constraint));
+            }
+        }
+    }
+    return lazy_constraints;
+}
+
+// the mode of a job is given by the first mode selection variable set to one
+std::vector<JobAllocation> ProblemSolverILP::get_job_allocations(const std::vector<double> &values) const
+{
+    const auto &job_variable_blocks = variable_mapping_ilp.get_job_variable_blocks();
+    std::vector<JobAllocation> job_allocations(job_variable_blocks.size());
+
+    auto job_allocation = job_allocations.begin();
+    for (const auto &block : job_variable_blocks)
+    {
+        job_allocation->job_id = block.job->id;
+        job_allocation->start_time = static_cast<size_t>(std::lround(values.at(block.start_time_variable)));
+        job_allocation->duration = static_cast<size_t>(std::lround(values.at(block.processing_time_variable)));
+        job_allocation->mode_id = get_selected_mode(block, values);
+        ++job_allocation;
+    }
+    return job_allocations;
+}
+
+std::vector<double> ProblemSolverILP::get_start_values(const std::vector<JobAllocation> &job_allocations) const
+{
+    const size_t horizon = problem_instance.makespan_upper_bound;
+    std::vector<double> values(variable_mapping_ilp.get_nb_variables(), std::numeric_limits<double>::quiet_NaN());
+
+    std::unordered_map<std::string_view, const JobAllocation *> allocations_by_job;
+    size_t makespan = 0;
+    for (const auto &job_allocation : job_allocations)
+    {
+        allocations_by_job.emplace(job_allocation.job_id, &job_allocation);
+        makespan = std::max(makespan, job_allocation.start_time + job_allocation.duration);
+    }
+    values[variable_mapping_ilp.c_max.begin()->second] = static_cast<double>(makespan);
+
+    // the pulse variables are set at the start only, the step ones from the start on
+    const bool cumulative = !variable_mapping_ilp.mu.empty();
+    for (const auto &block : variable_mapping_ilp.get_job_variable_blocks())
+    {
+        const auto it = allocations_by_job.find(block.job->id);
+        PPK_ASSERT_ERROR(it != allocations_by_job.end(), "The initial solution does not allocate job %s",
+                         block.job->id.c_str());
+        const JobAllocation &job_allocation = *it->second;
+        const size_t nb_modes = block.job->modes.size();
+        values[block.start_time_variable] = static_cast<double>(job_allocation.start_time);
+        values[block.processing_time_variable] = static_cast<double>(job_allocation.duration);
+
+        if (!variable_mapping_ilp.x.empty() && job_allocation.start_time < horizon)
+        {
+            for (size_t mode_id = 1; mode_id <= nb_modes; ++mode_id)
+            {
+                for (size_t t = 0; t < horizon; ++t)
+                {
+                    const bool started = cumulative ? t >= job_allocation.start_time : t == job_allocation.start_time;
+                    values[variable_mapping_ilp.x.at({block.job->id, std::to_string(mode_id), std::to_string(t)})] =
+                        mode_id == job_allocation.mode_id && started ? 1.0 : 0.0;
+                }
+            }
+        }
+        if (!variable_mapping_ilp.mu.empty())
+        {
+            for (size_t mode_id = 1; mode_id <= nb_modes; ++mode_id)
+            {
+                values[variable_mapping_ilp.mu.at({block.job->id, std::to_string(mode_id), std::to_string(0)})] =
+                    mode_id == job_allocation.mode_id ? 1.0 : 0.0;
+            }
+        }
+    }
+
+    // the variables fixed by the presolve are not part of the reduced model
+    std::vector<double> start_values(ilp_model.get_nb_variables(), std::numeric_limits<double>::quiet_NaN());
+    for (size_t index = 0; index < values.size(); ++index)
+    {
+        const size_t reduced_index = presolver.get_reduced_index(index);
+        if (reduced_index != ILPPresolver::REMOVED)
+        {
+            start_values[reduced_index] = values[index];
+        }
+    }
+    return start_values;
+}
+
+size_t ProblemSolverILP::get_selected_mode(const TimeIndexedModelVariableMapping::JobVariableBlock &block,
+                                           const std::vector<double> &values) const
+{
+    for (size_t index = block.first_mode_variable; index < block.last_mode_variable; ++index)
+    {
+        if (values[index] > 0.5)
+        {
+            return (index - block.first_mode_variable) % block.job->modes.size() + 1;
+        }
     }
+    PPK_ASSERT_ERROR(false, "No mode selected for job %s", block.job->id.c_str());
+    return 0;
 }
@@ -1,5 +1,6 @@
 #include "Algorithms/ILPOptimizationModel/VariableMappingBuilder.hpp"
 #include "External/pempek_assert.hpp"
+#include "ProblemInstance/PrecedenceGraph.hpp"
 #include "ProblemInstance/ProblemInstance.hpp"
 #include "Shared/Queue.hpp"
 #include "Shared/Utils.hpp"
@@ -23,13 +24,52 @@ TimeIndexedModelVariableMapping::TimeIndexedModelVariableMapping(const ProblemIn
     this->add_objective_function_variables();
     this->add_jobs_start_time_variables();
     this->add_jobs_processing_time_variables();
-    this->add_jobs_start_time_binary_variables();
-    this->add_jobs_resources_allocation_variables();
 }
 
 size_t TimeIndexedModelVariableMapping::get_nb_variables() const
 {
-    return (c_max.size() + x.size() + p.size() + s.size() + y.size());
+    return (c_max.size() + x.size() + p.size() + s.size() + y.size() + mu.size() + tau.size() + z.size());
+}
+
+const std::vector<TimeIndexedModelVariableMapping::JobVariableBlock> &
+TimeIndexedModelVariableMapping::get_job_variable_blocks() const
+{
+    return job_variable_blocks;
+}
+
+// with cumulative ("started by t") variables only the variables before the earliest start can be fixed
+std::vector<size_t> TimeIndexedModelVariableMapping::get_out_of_window_start_time_variables(bool cumulative) const
+{
+    const std::source_location loc = std::source_location::current();
+
+    PrecedenceGraph precedence_graph(problem_instance);
+    const std::vector<size_t> heads = precedence_graph.compute_heads();
+    const std::vector<size_t> tails = precedence_graph.compute_tails();
+    const auto horizon = static_cast<long>(problem_instance.makespan_upper_bound);
+
+    std::vector<size_t> out_of_window_variables;
+    for (size_t job_index = 0; job_index < precedence_graph.get_nb_jobs(); ++job_index)
+    {
+        const JobConstPtr &job = precedence_graph.get_job(job_index);
+        const auto successors_tail =
+            static_cast<long>(tails[job_index] - precedence_graph.get_min_processing_time(job_index));
+
+        size_t mode_id = 1;
+        for (const auto &mode : job->modes)
+        {
+            const long latest_start = horizon - successors_tail - static_cast<long>(mode.processing_time);
+            for (size_t t = 0; t < problem_instance.makespan_upper_bound; ++t)
+            {
+                if (t < heads[job_index] || (!cumulative && static_cast<long>(t) > latest_start))
+                {
+                    out_of_window_variables.emplace_back(
+                        get_value(x, {job->id, std::to_string(mode_id), std::to_string(t)}, loc));
+                }
+            }
+            ++mode_id;
+        }
+    }
+    return out_of_window_variables;
 }
 
 void TimeIndexedModelVariableMapping::add_objective_function_variables()
@@ -46,6 +86,7 @@ void TimeIndexedModelVariableMapping::add_jobs_processing_time_variables()
 {
     const std::source_location loc = std::source_location::current();
     size_t idx = get_nb_variables();
+    auto block = job_variable_blocks.begin();
 
     for (const JobConstPtr &job : this->problem_instance.job_queue)
     {
@@ -53,6 +94,8 @@ void TimeIndexedModelVariableMapping::add_jobs_processing_time_variables()
                                static_cast<double>(calculate_processing_time_upper_bound(job)));
         var_desc.emplace_back(std::format("p_{}", job->id));
         set_value(p, job->id, idx, loc);
+        block->processing_time_variable = idx;
+        ++block;
         ++idx;
     }
 }
@@ -68,6 +111,7 @@ void TimeIndexedModelVariableMapping::add_jobs_start_time_variables()
                                static_cast<double>(problem_instance.makespan_upper_bound));
         var_desc.emplace_back(std::format("s_{}", job->id));
         set_value(s, job->id, idx, loc);
+        job_variable_blocks.push_back({job, idx, 0, 0, 0});
         ++idx;
     }
 }
@@ -77,9 +121,18 @@ void TimeIndexedModelVariableMapping::add_jobs_start_time_binary_variables()
     const std::source_location loc = std::source_location::current();
 
     size_t idx = get_nb_variables();
+    auto block = job_variable_blocks.begin();
 
     for (const JobConstPtr &job : this->problem_instance.job_queue)
     {
+        // the pulse variables select the mode unless dedicated mode variables exist
+        if (block->first_mode_variable == block->last_mode_variable)
+        {
+            block->first_mode_variable = idx;
+            block->last_mode_variable = idx + problem_instance.makespan_upper_bound * job->modes.size();
+        }
+        ++block;
+
         for (size_t t = 0; t < problem_instance.makespan_upper_bound; ++t)
         {
             size_t mode_id = 1;
@@ -102,48 +155,56 @@ void TimeIndexedModelVariableMapping::add_jobs_resources_allocation_variables()
     // TODO if necessary
 }
 
-TimeIndexedModelVariableMapping::map1to1 lookup(const std::vector<double> &solution,
-                                                const TimeIndexedModelVariableMapping::map1to1 &mapping)
+void TimeIndexedModelVariableMapping::add_jobs_mode_variables()
 {
     const std::source_location loc = std::source_location::current();
 
-    TimeIndexedModelVariableMapping::map1to1 my_map;
-    for (const auto &[key, value] : mapping)
+    size_t idx = get_nb_variables();
+    auto block = job_variable_blocks.begin();
+
+    for (const JobConstPtr &job : this->problem_instance.job_queue)
     {
-        PPK_ASSERT_ERROR(value < solution.size(), "Invalid index");
-        set_value(my_map, key, solution[value], loc);
+        block->first_mode_variable = idx;
+        block->last_mode_variable = idx + job->modes.size();
+        ++block;
+
+        for (size_t mode_id = 1; mode_id <= job->modes.size(); ++mode_id)
+        {
+            variables.emplace_back(DecisionVariableType::BIN, 0.0, 1.0);
+            var_desc.emplace_back(std::format("mu_{{{}#{}}}", job->id, mode_id));
+            set_value(mu, {job->id, std::to_string(mode_id), std::to_string(0)}, idx, loc);
+            ++idx;
+        }
     }
-    return my_map;
 }
 
-TimeIndexedModelVariableMapping::map2to1 lookup(const std::vector<double> &solution,
-                                                const TimeIndexedModelVariableMapping::map2to1 &mapping)
+void TimeIndexedModelVariableMapping::add_event_variables()
 {
     const std::source_location loc = std::source_location::current();
 
-    TimeIndexedModelVariableMapping::map2to1 my_map;
-    for (const auto &[key, value] : mapping)
+    const size_t nb_events = problem_instance.job_queue.nb_elements();
+    size_t idx = get_nb_variables();
+
+    for (size_t e = 0; e < nb_events; ++e)
     {
-        PPK_ASSERT_ERROR(value < solution.size(), "Invalid index");
-        set_value(my_map, {std::get<0>(key), std::get<1>(key)}, solution[value], loc);
+        double upper_bound = (e == 0) ? 0.0 : static_cast<double>(problem_instance.makespan_upper_bound);
+        variables.emplace_back(DecisionVariableType::INT, 0.0, upper_bound);
+        var_desc.emplace_back(std::format("tau_{}", e));
+        set_value(tau, std::to_string(e), idx, loc);
+        ++idx;
     }
-    return my_map;
-}
 
-TimeIndexedModelVariableMapping::map1to1 lookup(const std::vector<double> &solution,
-                                                const TimeIndexedModelVariableMapping::map3to1 &mapping)
-{
-    const std::source_location loc = std::source_location::current();
-
-    TimeIndexedModelVariableMapping::map1to1 my_map;
-    for (const auto &[key, value] : mapping)
+    for (const JobConstPtr &job : this->problem_instance.job_queue)
     {
-        PPK_ASSERT_ERROR(value < solution.size(), "Invalid index");
-
-        if (solution[value] > 0)
+        for (size_t e = 0; e < nb_events; ++e)
         {
-            set_value(my_map, std::get<0>(key), std::stoi(std::get<1>(key)), loc);
+            for (size_t mode_id = 1; mode_id <= job->modes.size(); ++mode_id)
+            {
+                variables.emplace_back(DecisionVariableType::BIN, 0.0, 1.0);
+                var_desc.emplace_back(std::format("z_{{{}#{}#{}}}", job->id, mode_id, e));
+                set_value(z, {job->id, std::to_string(mode_id), std::to_string(e)}, idx, loc);
+                ++idx;
+            }
         }
     }
-    return my_map;
 }
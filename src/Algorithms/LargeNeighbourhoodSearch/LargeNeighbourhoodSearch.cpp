@@ -0,0 +1,394 @@
+#include "Algorithms/LargeNeighbourhoodSearch/LargeNeighbourhoodSearch.hpp"
+#include "Algorithms/CPSolver/CPSolver.hpp"
+#include "External/pempek_assert.hpp"
+#include "Settings.hpp"
+#include "loguru.hpp"
+#include <algorithm>
+#include <exception>
+#include <format>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <thread>
+
+static size_t get_nb_workers()
+{
+    return Settings::Solver::LNS_WORKERS == 0 ? Settings::Solver::NB_THREADS : Settings::Solver::LNS_WORKERS;
+}
+
+LargeNeighbourhoodSearch::SearchState::SearchState(std::vector<IncumbentListener> listeners,
+                                                   std::chrono::steady_clock::time_point deadline,
+                                                   size_t makespan_lower_bound)
+    : deadline(deadline), makespan_lower_bound(makespan_lower_bound), incumbent_publisher([this, &listeners] {
+          listeners.emplace_back(incumbent_store.get_listener());
+          return std::move(listeners);
+      }())
+{}
+
+LargeNeighbourhoodSearch::LargeNeighbourhoodSearch(const ProblemInstance &problem_instance)
+    : problem_instance(problem_instance), precedence_graph(problem_instance)
+{}
+
+void LargeNeighbourhoodSearch::add_incumbent_listener(IncumbentListener listener)
+{
+    incumbent_listeners.emplace_back(std::move(listener));
+}
+
+void LargeNeighbourhoodSearch::set_stop_token(std::stop_token stop_token) { this->stop_token = std::move(stop_token); }
+
+void LargeNeighbourhoodSearch::set_incumbent_source(const IncumbentStore &incumbent_store)
+{
+    incumbent_source = &incumbent_store;
+}
+
+void LargeNeighbourhoodSearch::set_seed(uint64_t seed) { random_seed = seed; }
+
+const std::map<std::string, LargeNeighbourhoodSearch::Neighbourhood, std::less<>> &
+LargeNeighbourhoodSearch::get_neighbourhoods()
+{
+    static const std::map<std::string, Neighbourhood, std::less<>> neighbourhoods = {
+        {"time_window", &LargeNeighbourhoodSearch::select_time_window},
+        {"resource_critical", &LargeNeighbourhoodSearch::select_resource_critical_jobs},
+        {"precedence_block", &LargeNeighbourhoodSearch::select_precedence_block}};
+    return neighbourhoods;
+}
+
+Solution LargeNeighbourhoodSearch::solve(const Solution &initial_solution)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                      std::chrono::duration<double>(Settings::Solver::MAX_RUNTIME));
+    const size_t makespan_lower_bound = std::max(precedence_graph.compute_critical_path_length(),
+                                                 problem_instance.compute_energy_lower_bound());
+
+    SearchState search_state(incumbent_listeners, deadline, makespan_lower_bound);
+
+    std::vector<JobAllocation> job_allocations = initial_solution.job_allocations.empty()
+                                                     ? find_initial_schedule(search_state)
+                                                     : sort_by_job_index(initial_solution.job_allocations);
+
+    Solution solution;
+    solution.solver_configuration =
+        std::format("LNS workers={} neighbourhood_size={} iteration_time_limit={}", get_nb_workers(),
+                    get_neighbourhood_size(), Settings::Solver::LNS_ITERATION_TIME_LIMIT);
+
+    if (job_allocations.empty())
+    {
+        LOG_F(INFO, "LNS did not find an initial schedule within the time limit of %f", Settings::Solver::MAX_RUNTIME);
+        solution.solution_state = SolutionState::UNKNOWN;
+        return solution;
+    }
+    publish(search_state, job_allocations);
+
+    // every worker owns its CP model, only the incumbent store is shared
+    {
+        std::vector<std::jthread> workers;
+        for (size_t worker_index = 0; worker_index < get_nb_workers(); ++worker_index)
+        {
+            workers.emplace_back([this, worker_index, &search_state] {
+                try
+                {
+                    run_worker(worker_index, search_state);
+                } catch (...)
+                {
+                    std::scoped_lock lock(search_state.publisher_mutex);
+                    if (!search_state.worker_exception)
+                    {
+                        search_state.worker_exception = std::current_exception();
+                    }
+                }
+            });
+        }
+    }
+
+    // the first failure of a worker is reported once all the workers stopped
+    if (search_state.worker_exception)
+    {
+        std::rethrow_exception(search_state.worker_exception);
+    }
+
+    const std::optional<Incumbent> best = search_state.incumbent_store.get_best();
+    PPK_ASSERT_ERROR(best.has_value(), "LNS lost its incumbent");
+
+    solution.solution_state =
+        best->makespan == makespan_lower_bound ? SolutionState::OPTIMAL : SolutionState::FEASIBLE;
+    solution.makespan = best->makespan;
+    solution.objective_bound = static_cast<double>(makespan_lower_bound);
+    solution.gap = static_cast<double>(best->makespan - makespan_lower_bound) / static_cast<double>(best->makespan);
+    solution.runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    solution.job_allocations = best->job_allocations;
+    return solution;
+}
+
+std::vector<JobAllocation> LargeNeighbourhoodSearch::find_initial_schedule(SearchState &search_state) const
+{
+    // the time limit is doubled until a first schedule is found, the later iterations are the only long ones
+    CPSolver cp_solver(problem_instance);
+    cp_solver.set_stop_token(stop_token);
+    for (double time_limit = Settings::Solver::LNS_ITERATION_TIME_LIMIT;
+         std::chrono::steady_clock::now() < search_state.deadline && !stop_token.stop_requested(); time_limit *= 2.0)
+    {
+        const double remaining_time =
+            std::chrono::duration<double>(search_state.deadline - std::chrono::steady_clock::now()).count();
+        const Solution solution = cp_solver.solve(std::min(time_limit, remaining_time));
+        if (solution.solution_state == SolutionState::OPTIMAL || solution.solution_state == SolutionState::FEASIBLE)
+        {
+            return solution.job_allocations;
+        }
+    }
+    return {};
+}
+
+void LargeNeighbourhoodSearch::run_worker(size_t worker_index, SearchState &search_state) const
+{
+    CPSolver cp_solver(problem_instance);
+    cp_solver.set_nb_workers(1);
+    cp_solver.set_stop_token(stop_token);
+    RandomGenerator generator(random_seed, worker_index);
+
+    const auto &neighbourhoods = get_neighbourhoods();
+    const size_t nb_jobs = precedence_graph.get_nb_jobs();
+
+    // the workers start on different neighbourhoods and cycle through all of them
+    for (size_t iteration = worker_index;
+         std::chrono::steady_clock::now() < search_state.deadline && !stop_token.stop_requested(); ++iteration)
+    {
+        import_incumbent(search_state);
+        const std::optional<Incumbent> incumbent = search_state.incumbent_store.get_best();
+        if (incumbent->makespan == search_state.makespan_lower_bound)
+        {
+            return;
+        }
+
+        const auto neighbourhood = std::next(neighbourhoods.begin(), iteration % neighbourhoods.size());
+        std::vector<bool> released(nb_jobs, false);
+        for (size_t job_index : std::invoke(neighbourhood->second, this, incumbent->job_allocations, generator))
+        {
+            released[job_index] = true;
+        }
+
+        // the jobs outside the neighbourhood keep their mode and may only move earlier, the incumbent stays feasible
+        std::vector<std::string> released_job_ids;
+        for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+        {
+            const JobAllocation &job_allocation = incumbent->job_allocations[job_index];
+            if (released[job_index])
+            {
+                released_job_ids.emplace_back(job_allocation.job_id);
+            } else
+            {
+                cp_solver.restrict_job(job_allocation.job_id, job_allocation.start_time, job_allocation.mode_id);
+            }
+        }
+        cp_solver.unfreeze_jobs(released_job_ids);
+
+        Solution starting_point;
+        starting_point.job_allocations = incumbent->job_allocations;
+        cp_solver.set_starting_point(starting_point);
+
+        const double remaining_time =
+            std::chrono::duration<double>(search_state.deadline - std::chrono::steady_clock::now()).count();
+        if (remaining_time <= 0.0)
+        {
+            return;
+        }
+
+        const Solution solution =
+            cp_solver.solve(std::min(Settings::Solver::LNS_ITERATION_TIME_LIMIT, remaining_time));
+        if ((solution.solution_state == SolutionState::OPTIMAL || solution.solution_state == SolutionState::FEASIBLE) &&
+            solution.makespan < incumbent->makespan)
+        {
+            LOG_F(1, "LNS worker %zu: the %s neighbourhood improved the makespan from %zu to %zu", worker_index,
+                  neighbourhood->first.c_str(), incumbent->makespan, solution.makespan);
+            publish(search_state, solution.job_allocations);
+        }
+    }
+}
+
+void LargeNeighbourhoodSearch::publish(SearchState &search_state,
+                                       const std::vector<JobAllocation> &job_allocations) const
+{
+    size_t makespan = 0;
+    for (const auto &job_allocation : job_allocations)
+    {
+        makespan = std::max(makespan, job_allocation.start_time + job_allocation.duration);
+    }
+
+    std::scoped_lock lock(search_state.publisher_mutex);
+    search_state.incumbent_publisher.publish(makespan, static_cast<double>(search_state.makespan_lower_bound),
+                                             job_allocations);
+}
+
+// the imported schedule only enters the own store, it is not published again
+void LargeNeighbourhoodSearch::import_incumbent(SearchState &search_state) const
+{
+    if (incumbent_source == nullptr ||
+        incumbent_source->get_best_makespan() >= search_state.incumbent_store.get_best_makespan())
+    {
+        return;
+    }
+    std::optional<Incumbent> incumbent = incumbent_source->get_best();
+    incumbent->job_allocations = sort_by_job_index(incumbent->job_allocations);
+    search_state.incumbent_store.offer(*incumbent);
+}
+
+std::vector<JobAllocation> LargeNeighbourhoodSearch::sort_by_job_index(
+    const std::vector<JobAllocation> &job_allocations) const
+{
+    PPK_ASSERT_ERROR(job_allocations.size() == precedence_graph.get_nb_jobs(),
+                     "the initial solution must allocate every job");
+
+    std::vector<JobAllocation> sorted_job_allocations(job_allocations.size());
+    for (const auto &job_allocation : job_allocations)
+    {
+        sorted_job_allocations[precedence_graph.get_job_index(job_allocation.job_id)] = job_allocation;
+    }
+    return sorted_job_allocations;
+}
+
+size_t LargeNeighbourhoodSearch::get_neighbourhood_size() const
+{
+    return std::min(Settings::Solver::LNS_NEIGHBOURHOOD_SIZE, precedence_graph.get_nb_jobs());
+}
+
+std::vector<size_t> LargeNeighbourhoodSearch::select_time_window(const std::vector<JobAllocation> &job_allocations,
+                                                                 RandomGenerator &generator) const
+{
+    std::vector<size_t> start_order(job_allocations.size());
+    std::iota(start_order.begin(), start_order.end(), 0);
+    std::ranges::sort(start_order, std::ranges::less{},
+                      [&job_allocations](size_t job_index) { return job_allocations[job_index].start_time; });
+
+    // the window covers consecutive jobs in start time order
+    const size_t neighbourhood_size = get_neighbourhood_size();
+    const size_t first_position = generator.uniform_index(start_order.size() - neighbourhood_size + 1);
+    const auto first = start_order.begin() + static_cast<std::ptrdiff_t>(first_position);
+    return {first, first + static_cast<std::ptrdiff_t>(neighbourhood_size)};
+}
+
+std::vector<size_t> LargeNeighbourhoodSearch::select_resource_critical_jobs(
+    const std::vector<JobAllocation> &job_allocations, RandomGenerator &generator) const
+{
+    const std::vector<Resource> &resources = problem_instance.get_resources();
+    if (resources.empty())
+    {
+        // without resources there is no peak usage to release the jobs around
+        return select_random_jobs(job_allocations, generator);
+    }
+    const size_t resource_index = generator.uniform_index(resources.size());
+
+    auto get_demand = [this, &job_allocations, resource_index](size_t job_index) {
+        const Mode &mode = precedence_graph.get_job(job_index)->modes.at(job_allocations[job_index].mode_id - 1);
+        return mode.requested_resources.at(resource_index).units;
+    };
+
+    size_t makespan = 0;
+    for (const auto &job_allocation : job_allocations)
+    {
+        makespan = std::max(makespan, job_allocation.start_time + job_allocation.duration);
+    }
+
+    std::vector<long> usage_changes(makespan + 1, 0);
+    for (size_t job_index = 0; job_index < job_allocations.size(); ++job_index)
+    {
+        const auto demand = static_cast<long>(get_demand(job_index));
+        usage_changes[job_allocations[job_index].start_time] += demand;
+        usage_changes[job_allocations[job_index].start_time + job_allocations[job_index].duration] -= demand;
+    }
+
+    // a random time point among those with the peak usage of the resource
+    long usage = 0;
+    long peak_usage = -1;
+    size_t peak_time = 0;
+    size_t nb_peak_times = 0;
+    for (size_t t = 0; t < makespan; ++t)
+    {
+        usage += usage_changes[t];
+        if (usage > peak_usage)
+        {
+            peak_usage = usage;
+            peak_time = t;
+            nb_peak_times = 1;
+        } else if (usage == peak_usage && generator.uniform_index(++nb_peak_times) == 0)
+        {
+            peak_time = t;
+        }
+    }
+
+    // the jobs using the resource come first, by distance of their execution to the peak
+    auto get_distance = [&job_allocations, peak_time](size_t job_index) {
+        const size_t start_time = job_allocations[job_index].start_time;
+        const size_t end_time = start_time + job_allocations[job_index].duration;
+        if (peak_time < start_time)
+        {
+            return start_time - peak_time;
+        }
+        return peak_time < end_time ? 0 : peak_time - end_time + 1;
+    };
+
+    std::vector<size_t> job_indices(job_allocations.size());
+    std::iota(job_indices.begin(), job_indices.end(), 0);
+    std::ranges::sort(job_indices, std::ranges::less{}, [&](size_t job_index) {
+        return std::pair(get_demand(job_index) == 0, get_distance(job_index));
+    });
+    job_indices.resize(get_neighbourhood_size());
+    return job_indices;
+}
+
+std::vector<size_t> LargeNeighbourhoodSearch::select_precedence_block(
+    const std::vector<JobAllocation> &job_allocations, RandomGenerator &generator) const
+{
+    const size_t neighbourhood_size = get_neighbourhood_size();
+
+    // breadth-first search over predecessors and successors, restarted from a random job when a component is exhausted
+    std::vector<bool> visited(job_allocations.size(), false);
+    std::vector<size_t> block;
+    std::queue<size_t> frontier;
+    while (block.size() < neighbourhood_size)
+    {
+        if (frontier.empty())
+        {
+            size_t seed_job = generator.uniform_index(job_allocations.size());
+            while (visited[seed_job])
+            {
+                seed_job = (seed_job + 1) % visited.size();
+            }
+            visited[seed_job] = true;
+            frontier.emplace(seed_job);
+        }
+
+        const size_t job_index = frontier.front();
+        frontier.pop();
+        block.emplace_back(job_index);
+
+        for (const auto *neighbours :
+             {&precedence_graph.get_predecessors(job_index), &precedence_graph.get_successors(job_index)})
+        {
+            for (size_t neighbour : *neighbours)
+            {
+                if (!visited[neighbour])
+                {
+                    visited[neighbour] = true;
+                    frontier.emplace(neighbour);
+                }
+            }
+        }
+    }
+    return block;
+}
+
+std::vector<size_t> LargeNeighbourhoodSearch::select_random_jobs(const std::vector<JobAllocation> &job_allocations,
+                                                                 RandomGenerator &generator) const
+{
+    // partial Fisher-Yates shuffle of the job indices
+    std::vector<size_t> job_indices(job_allocations.size());
+    std::iota(job_indices.begin(), job_indices.end(), 0);
+    const size_t neighbourhood_size = get_neighbourhood_size();
+    for (size_t position = 0; position < neighbourhood_size; ++position)
+    {
+        std::swap(job_indices[position],
+                  job_indices[position + generator.uniform_index(job_indices.size() - position)]);
+    }
+    job_indices.resize(neighbourhood_size);
+    return job_indices;
+}
@@ -0,0 +1,330 @@
+#include "Algorithms/ScheduleGeneration/PriorityRuleHeuristic.hpp"
+#include "External/pempek_assert.hpp"
+#include "Settings.hpp"
+#include "loguru.hpp"
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <functional>
+#include <ranges>
+#include <thread>
+
+PriorityRuleHeuristic::SearchState::SearchState(std::vector<IncumbentListener> listeners, size_t makespan_lower_bound,
+                                                std::chrono::steady_clock::time_point deadline)
+    : deadline(deadline), shared_incumbent(std::move(listeners), makespan_lower_bound)
+{}
+
+PriorityRuleHeuristic::PriorityRuleHeuristic(const ProblemInstance &problem_instance)
+    : problem_instance(problem_instance), precedence_graph(problem_instance),
+      heads(precedence_graph.compute_heads()), tails(precedence_graph.compute_tails()),
+      nb_passes(Settings::Solver::PRIORITY_RULE_PASSES)
+{
+    const std::vector<Resource> &resources = problem_instance.get_resources();
+    for (size_t job_index = 0; job_index < precedence_graph.get_nb_jobs(); ++job_index)
+    {
+        const auto &modes = precedence_graph.get_job(job_index)->modes;
+        std::vector<size_t> job_executable_modes;
+        for (size_t mode_index = 0; mode_index < modes.size(); ++mode_index)
+        {
+            const auto &requested_resources = modes[mode_index].requested_resources;
+            const bool executable = std::ranges::all_of(std::views::iota(size_t{0}, resources.size()), [&](size_t r) {
+                return requested_resources.at(r).units <= resources[r].units;
+            });
+            if (executable)
+            {
+                job_executable_modes.emplace_back(mode_index);
+            }
+        }
+        PPK_ASSERT_ERROR(!job_executable_modes.empty(), "Job %s has no executable mode",
+                         precedence_graph.get_job(job_index)->id.c_str());
+
+        shortest_modes.emplace_back(std::ranges::min(job_executable_modes, std::ranges::less{}, [&modes](size_t m) {
+            return modes[m].processing_time;
+        }));
+        min_durations.emplace_back(modes[shortest_modes.back()].processing_time);
+        executable_modes.emplace_back(std::move(job_executable_modes));
+    }
+
+    for (const auto &[name, rule] : get_priority_rules())
+    {
+        rule_priorities.emplace_back(std::invoke(rule, this));
+    }
+    makespan_lower_bound =
+        std::max(precedence_graph.compute_critical_path_length(), problem_instance.compute_energy_lower_bound());
+}
+
+void PriorityRuleHeuristic::add_incumbent_listener(IncumbentListener listener)
+{
+    incumbent_listeners.emplace_back(std::move(listener));
+}
+
+void PriorityRuleHeuristic::set_stop_token(std::stop_token stop_token) { this->stop_token = std::move(stop_token); }
+
+void PriorityRuleHeuristic::set_nb_passes(size_t nb_passes)
+{
+    PPK_ASSERT_ERROR(nb_passes > 0, "at least one priority rule pass is required");
+    this->nb_passes = nb_passes;
+}
+
+void PriorityRuleHeuristic::set_seed(uint64_t seed) { random_seed = seed; }
+
+const std::map<std::string, PriorityRuleHeuristic::PriorityRule, std::less<>> &
+PriorityRuleHeuristic::get_priority_rules()
+{
+    static const std::map<std::string, PriorityRule, std::less<>> priority_rules = {
+        {"lft", &PriorityRuleHeuristic::compute_latest_finish_priorities},
+        {"lst", &PriorityRuleHeuristic::compute_latest_start_priorities},
+        {"mts", &PriorityRuleHeuristic::compute_most_total_successors_priorities},
+        {"grpw", &PriorityRuleHeuristic::compute_greatest_rank_positional_weight_priorities},
+        {"mslk", &PriorityRuleHeuristic::compute_minimum_slack_priorities}};
+    return priority_rules;
+}
+
+Solution PriorityRuleHeuristic::solve()
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                      std::chrono::duration<double>(Settings::Solver::MAX_RUNTIME));
+    const size_t nb_workers = std::max<size_t>(Settings::Solver::NB_THREADS, 1);
+
+    SearchState search_state(incumbent_listeners, makespan_lower_bound, deadline);
+    {
+        std::vector<std::jthread> workers;
+        for (size_t worker_index = 0; worker_index < nb_workers; ++worker_index)
+        {
+            workers.emplace_back([this, &search_state] {
+                try
+                {
+                    run_passes(search_state);
+                } catch (...)
+                {
+                    std::scoped_lock lock(search_state.exception_mutex);
+                    if (!search_state.worker_exception)
+                    {
+                        search_state.worker_exception = std::current_exception();
+                    }
+                }
+            });
+        }
+    }
+
+    if (search_state.worker_exception)
+    {
+        std::rethrow_exception(search_state.worker_exception);
+    }
+
+    Solution solution;
+    solution.solver_configuration = std::format("PriorityRules threads={} passes={}", nb_workers,
+                                                std::min(search_state.next_pass.load(), nb_passes));
+    solution.runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    search_state.shared_incumbent.complete_solution(solution);
+    return solution;
+}
+
+void PriorityRuleHeuristic::run_passes(SearchState &search_state) const
+{
+    ScheduleDecoder decoder(problem_instance);
+    std::vector<size_t> activity_list;
+    std::vector<size_t> job_modes;
+
+    // the passes are taken one by one so that the threads share them evenly
+    for (size_t pass = search_state.next_pass.fetch_add(1); pass < nb_passes;
+         pass = search_state.next_pass.fetch_add(1))
+    {
+        if (std::chrono::steady_clock::now() >= search_state.deadline || stop_token.stop_requested() ||
+            search_state.shared_incumbent.reached_lower_bound())
+        {
+            return;
+        }
+
+        const bool sampled = pass >= rule_priorities.size();
+        RandomGenerator generator(random_seed, pass);
+        build_activity_list(rule_priorities[pass % rule_priorities.size()], sampled, generator, activity_list);
+        build_job_modes(sampled, generator, job_modes);
+
+        const size_t serial_makespan = decoder.decode(activity_list, job_modes);
+        const bool serial_improves = serial_makespan < search_state.shared_incumbent.get_best_makespan();
+        std::vector<JobAllocation> serial_job_allocations;
+        if (serial_improves)
+        {
+            serial_job_allocations = decoder.get_job_allocations(job_modes);
+        }
+        const size_t parallel_makespan = decoder.decode_parallel(activity_list, job_modes);
+
+        const bool parallel_is_better = parallel_makespan < serial_makespan;
+        const size_t makespan = parallel_is_better ? parallel_makespan : serial_makespan;
+        if (makespan >= search_state.shared_incumbent.get_best_makespan())
+        {
+            continue;
+        }
+
+        search_state.shared_incumbent.offer(
+            makespan, parallel_is_better ? decoder.get_job_allocations(job_modes) : std::move(serial_job_allocations));
+    }
+}
+
+void PriorityRuleHeuristic::build_activity_list(const std::vector<double> &priorities, bool sampled,
+                                                RandomGenerator &generator, std::vector<size_t> &activity_list) const
+{
+    const size_t nb_jobs = precedence_graph.get_nb_jobs();
+    std::vector<size_t> nb_unlisted_predecessors(nb_jobs);
+    std::vector<size_t> eligible_jobs;
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        nb_unlisted_predecessors[job_index] = precedence_graph.get_predecessors(job_index).size();
+        if (nb_unlisted_predecessors[job_index] == 0)
+        {
+            eligible_jobs.emplace_back(job_index);
+        }
+    }
+
+    activity_list.clear();
+    std::vector<double> cumulative_weights;
+    while (!eligible_jobs.empty())
+    {
+        size_t selected = 0;
+        if (sampled)
+        {
+            // regret based biased sampling: the weight grows with the priority over the least prioritised eligible job
+            const double min_priority = std::ranges::min(eligible_jobs | std::views::transform([&](size_t job_index) {
+                                                             return priorities[job_index];
+                                                         }));
+            cumulative_weights.clear();
+            double total_weight = 0.0;
+            for (size_t job_index : eligible_jobs)
+            {
+                total_weight += priorities[job_index] - min_priority + 1.0;
+                cumulative_weights.emplace_back(total_weight);
+            }
+            selected = generator.weighted_index(cumulative_weights);
+        } else
+        {
+            for (size_t position = 1; position < eligible_jobs.size(); ++position)
+            {
+                if (priorities[eligible_jobs[position]] > priorities[eligible_jobs[selected]])
+                {
+                    selected = position;
+                }
+            }
+        }
+
+        const size_t job_index = eligible_jobs[selected];
+        eligible_jobs[selected] = eligible_jobs.back();
+        eligible_jobs.pop_back();
+        activity_list.emplace_back(job_index);
+        for (size_t succ_index : precedence_graph.get_successors(job_index))
+        {
+            if (--nb_unlisted_predecessors[succ_index] == 0)
+            {
+                eligible_jobs.emplace_back(succ_index);
+            }
+        }
+    }
+    PPK_ASSERT_ERROR(activity_list.size() == nb_jobs, "the precedence graph has a cycle");
+}
+
+void PriorityRuleHeuristic::build_job_modes(bool sampled, RandomGenerator &generator,
+                                            std::vector<size_t> &job_modes) const
+{
+    if (!sampled)
+    {
+        job_modes = shortest_modes;
+        return;
+    }
+
+    // the shorter modes are more likely, the resource usage decides between the modes only through the decoding
+    job_modes.resize(precedence_graph.get_nb_jobs());
+    std::vector<double> cumulative_weights;
+    for (size_t job_index = 0; job_index < job_modes.size(); ++job_index)
+    {
+        const auto &modes = precedence_graph.get_job(job_index)->modes;
+        size_t max_duration = 0;
+        for (size_t mode_index : executable_modes[job_index])
+        {
+            max_duration = std::max(max_duration, modes[mode_index].processing_time);
+        }
+        cumulative_weights.clear();
+        double total_weight = 0.0;
+        for (size_t mode_index : executable_modes[job_index])
+        {
+            total_weight += static_cast<double>(max_duration - modes[mode_index].processing_time + 1);
+            cumulative_weights.emplace_back(total_weight);
+        }
+        job_modes[job_index] = executable_modes[job_index][generator.weighted_index(cumulative_weights)];
+    }
+}
+
+std::vector<double> PriorityRuleHeuristic::compute_latest_finish_priorities() const
+{
+    // the latest finish time is the critical path length minus the tail without the job itself
+    std::vector<double> priorities;
+    for (size_t job_index = 0; job_index < precedence_graph.get_nb_jobs(); ++job_index)
+    {
+        priorities.emplace_back(
+            static_cast<double>(tails[job_index] - precedence_graph.get_min_processing_time(job_index)));
+    }
+    return priorities;
+}
+
+std::vector<double> PriorityRuleHeuristic::compute_latest_start_priorities() const
+{
+    return {tails.begin(), tails.end()};
+}
+
+std::vector<double> PriorityRuleHeuristic::compute_most_total_successors_priorities() const
+{
+    const size_t nb_jobs = precedence_graph.get_nb_jobs();
+    const size_t nb_words = (nb_jobs + 63) / 64;
+    std::vector<std::vector<uint64_t>> reachable(nb_jobs, std::vector<uint64_t>(nb_words, 0));
+
+    const auto &topological_order = precedence_graph.get_topological_order();
+    for (auto it = topological_order.rbegin(); it != topological_order.rend(); ++it)
+    {
+        for (size_t succ_index : precedence_graph.get_successors(*it))
+        {
+            reachable[*it][succ_index / 64] |= uint64_t{1} << (succ_index % 64);
+            for (size_t word = 0; word < nb_words; ++word)
+            {
+                reachable[*it][word] |= reachable[succ_index][word];
+            }
+        }
+    }
+
+    std::vector<double> priorities;
+    for (const auto &reachable_jobs : reachable)
+    {
+        size_t nb_successors = 0;
+        for (uint64_t word : reachable_jobs)
+        {
+            nb_successors += static_cast<size_t>(std::popcount(word));
+        }
+        priorities.emplace_back(static_cast<double>(nb_successors));
+    }
+    return priorities;
+}
+
+std::vector<double> PriorityRuleHeuristic::compute_greatest_rank_positional_weight_priorities() const
+{
+    std::vector<double> priorities;
+    for (size_t job_index = 0; job_index < precedence_graph.get_nb_jobs(); ++job_index)
+    {
+        size_t weight = min_durations[job_index];
+        for (size_t succ_index : precedence_graph.get_successors(job_index))
+        {
+            weight += min_durations[succ_index];
+        }
+        priorities.emplace_back(static_cast<double>(weight));
+    }
+    return priorities;
+}
+
+std::vector<double> PriorityRuleHeuristic::compute_minimum_slack_priorities() const
+{
+    // the slack is the critical path length minus the longest path through the job
+    std::vector<double> priorities;
+    for (size_t job_index = 0; job_index < precedence_graph.get_nb_jobs(); ++job_index)
+    {
+        priorities.emplace_back(static_cast<double>(heads[job_index] + tails[job_index]));
+    }
+    return priorities;
+}
@@ -0,0 +1,121 @@
+#include "Algorithms/ScheduleGeneration/ResourceProfileTree.hpp"
+#include "External/pempek_assert.hpp"
+#include <algorithm>
+
+ResourceProfileTree::ResourceProfileTree(size_t horizon)
+    : horizon(horizon), max_usages(4 * std::max<size_t>(horizon, 1), 0), added_units(max_usages.size(), 0)
+{}
+
+size_t ResourceProfileTree::get_horizon() const { return horizon; }
+
+void ResourceProfileTree::add(size_t first, size_t last, long long units)
+{
+    PPK_ASSERT_ERROR(last <= horizon, "the time window [%zu, %zu) exceeds the horizon %zu", first, last, horizon);
+    if (first < last)
+    {
+        add(1, 0, horizon, first, last, units);
+    }
+}
+
+long long ResourceProfileTree::get_max(size_t first, size_t last) const
+{
+    PPK_ASSERT_ERROR(last <= horizon, "the time window [%zu, %zu) exceeds the horizon %zu", first, last, horizon);
+    return first < last ? get_max(1, 0, horizon, first, last) : 0;
+}
+
+size_t ResourceProfileTree::find_first_above(size_t first, size_t last, long long threshold) const
+{
+    PPK_ASSERT_ERROR(last <= horizon, "the time window [%zu, %zu) exceeds the horizon %zu", first, last, horizon);
+    return first < last ? find_above(1, 0, horizon, first, last, threshold, true) : npos;
+}
+
+size_t ResourceProfileTree::find_last_above(size_t first, size_t last, long long threshold) const
+{
+    PPK_ASSERT_ERROR(last <= horizon, "the time window [%zu, %zu) exceeds the horizon %zu", first, last, horizon);
+    return first < last ? find_above(1, 0, horizon, first, last, threshold, false) : npos;
+}
+
+void ResourceProfileTree::add(size_t node, size_t node_first, size_t node_last, size_t first, size_t last,
+                              long long units)
+{
+    if (first <= node_first && node_last <= last)
+    {
+        added_units[node] += units;
+        max_usages[node] += units;
+        return;
+    }
+
+    const size_t middle = node_first + (node_last - node_first) / 2;
+    if (first < middle)
+    {
+        add(2 * node, node_first, middle, first, last, units);
+    }
+    if (middle < last)
+    {
+        add(2 * node + 1, middle, node_last, first, last, units);
+    }
+    max_usages[node] = std::max(max_usages[2 * node], max_usages[2 * node + 1]) + added_units[node];
+}
+
+long long ResourceProfileTree::get_max(size_t node, size_t node_first, size_t node_last, size_t first,
+                                       size_t last) const
+{
+    if (first <= node_first && node_last <= last)
+    {
+        return max_usages[node];
+    }
+
+    const size_t middle = node_first + (node_last - node_first) / 2;
+    long long max_usage = std::numeric_limits<long long>::min();
+    if (first < middle)
+    {
+        max_usage = std::max(max_usage, get_max(2 * node, node_first, middle, first, last));
+    }
+    if (middle < last)
+    {
+        max_usage = std::max(max_usage, get_max(2 * node + 1, middle, node_last, first, last));
+    }
+    return max_usage + added_units[node];
+}
+
+size_t ResourceProfileTree::find_above(size_t node, size_t node_first, size_t node_last, size_t first, size_t last,
+                                       long long threshold, bool leftmost) const
+{
+    // the threshold is lowered by the additions of the ancestors on the way down
+    if (max_usages[node] <= threshold)
+    {
+        return npos;
+    }
+    if (node_last - node_first == 1)
+    {
+        return node_first;
+    }
+
+    const size_t middle = node_first + (node_last - node_first) / 2;
+    const long long child_threshold = threshold - added_units[node];
+    const bool left_overlaps = first < middle;
+    const bool right_overlaps = middle < last;
+    if (leftmost)
+    {
+        if (left_overlaps)
+        {
+            const size_t time = find_above(2 * node, node_first, middle, first, last, child_threshold, leftmost);
+            if (time != npos)
+            {
+                return time;
+            }
+        }
+        return right_overlaps ? find_above(2 * node + 1, middle, node_last, first, last, child_threshold, leftmost)
+                              : npos;
+    }
+
+    if (right_overlaps)
+    {
+        const size_t time = find_above(2 * node + 1, middle, node_last, first, last, child_threshold, leftmost);
+        if (time != npos)
+        {
+            return time;
+        }
+    }
+    return left_overlaps ? find_above(2 * node, node_first, middle, first, last, child_threshold, leftmost) : npos;
+}
@@ -0,0 +1,291 @@
+#include "Algorithms/ScheduleGeneration/ScheduleDecoder.hpp"
+#include "External/pempek_assert.hpp"
+#include <algorithm>
+#include <limits>
+
+ScheduleDecoder::ScheduleDecoder(const ProblemInstance &problem_instance)
+    : precedence_graph(problem_instance), nb_jobs(precedence_graph.get_nb_jobs()),
+      nb_resources(problem_instance.get_resources().size())
+{
+    for (const auto &resource : problem_instance.get_resources())
+    {
+        capacities.emplace_back(resource.units);
+    }
+
+    size_t max_release_time = 0;
+    size_t sum_max_durations = 0;
+    predecessor_offsets.emplace_back(0);
+    successor_offsets.emplace_back(0);
+    mode_offsets.emplace_back(0);
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        release_times.emplace_back(precedence_graph.get_release_time(job_index));
+        max_release_time = std::max(max_release_time, release_times.back());
+
+        const auto &predecessors = precedence_graph.get_predecessors(job_index);
+        predecessor_indices.insert(predecessor_indices.end(), predecessors.begin(), predecessors.end());
+        predecessor_offsets.emplace_back(predecessor_indices.size());
+        const auto &successors = precedence_graph.get_successors(job_index);
+        successor_indices.insert(successor_indices.end(), successors.begin(), successors.end());
+        successor_offsets.emplace_back(successor_indices.size());
+
+        size_t max_duration = 0;
+        for (const auto &mode : precedence_graph.get_job(job_index)->modes)
+        {
+            PPK_ASSERT_ERROR(mode.requested_resources.size() == nb_resources,
+                             "every mode must request every resource");
+            durations.emplace_back(mode.processing_time);
+            for (const auto &requested_resource : mode.requested_resources)
+            {
+                demands.emplace_back(requested_resource.units);
+            }
+            max_duration = std::max(max_duration, mode.processing_time);
+        }
+        mode_offsets.emplace_back(durations.size());
+        sum_max_durations += max_duration;
+    }
+
+    horizon = max_release_time + sum_max_durations + 1;
+    profile = make_resource_profile(capacities, demands, horizon);
+    start_times.assign(nb_jobs, 0);
+    finish_times.assign(nb_jobs, 0);
+    nb_unscheduled_predecessors.assign(nb_jobs, 0);
+    earliest_starts.assign(nb_jobs, 0);
+    scheduled.assign(nb_jobs, false);
+    prefix_makespans.assign(nb_jobs, 0);
+    decoded_activity_list.assign(nb_jobs, 0);
+    decoded_job_modes.assign(nb_jobs, 0);
+}
+
+size_t ScheduleDecoder::decode(const std::vector<size_t> &activity_list, const std::vector<size_t> &job_modes)
+{
+    PPK_ASSERT_ERROR(activity_list.size() == nb_jobs && job_modes.size() == nb_jobs,
+                     "one position and one mode per job are expected");
+
+    std::visit([this](auto &typed_profile) { typed_profile.clear(used_horizon); }, profile);
+    return decode_from(activity_list, job_modes, 0);
+}
+
+size_t ScheduleDecoder::redecode(const std::vector<size_t> &activity_list, const std::vector<size_t> &job_modes)
+{
+    if (!serial_decoded)
+    {
+        return decode(activity_list, job_modes);
+    }
+    PPK_ASSERT_ERROR(activity_list.size() == nb_jobs && job_modes.size() == nb_jobs,
+                     "one position and one mode per job are expected");
+
+    // the jobs before the first position whose job or mode changed keep their start times
+    size_t first_position = 0;
+    while (first_position < nb_jobs && activity_list[first_position] == decoded_activity_list[first_position] &&
+           job_modes[activity_list[first_position]] == decoded_job_modes[activity_list[first_position]])
+    {
+        ++first_position;
+    }
+    for (size_t position = first_position; position < nb_jobs; ++position)
+    {
+        const size_t job_index = decoded_activity_list[position];
+        unplace(job_index, mode_offsets[job_index] + decoded_job_modes[job_index]);
+    }
+    return decode_from(activity_list, job_modes, first_position);
+}
+
+size_t ScheduleDecoder::decode_from(const std::vector<size_t> &activity_list, const std::vector<size_t> &job_modes,
+                                    size_t first_position)
+{
+    return std::visit(
+        [this, &activity_list, &job_modes, first_position](auto &typed_profile) {
+            return decode_from(typed_profile, activity_list, job_modes, first_position);
+        },
+        profile);
+}
+
+template <typename Profile>
+size_t ScheduleDecoder::decode_from(Profile &typed_profile, const std::vector<size_t> &activity_list,
+                                    const std::vector<size_t> &job_modes, size_t first_position)
+{
+    size_t makespan = first_position > 0 ? prefix_makespans[first_position - 1] : 0;
+    for (size_t position = first_position; position < nb_jobs; ++position)
+    {
+        const size_t job_index = activity_list[position];
+        size_t earliest_start = release_times[job_index];
+        for (size_t k = predecessor_offsets[job_index]; k < predecessor_offsets[job_index + 1]; ++k)
+        {
+            earliest_start = std::max(earliest_start, finish_times[predecessor_indices[k]]);
+        }
+
+        const size_t mode_offset = mode_offsets[job_index] + job_modes[job_index];
+        const size_t duration = durations[mode_offset];
+        const size_t start_time = typed_profile.find_earliest_start(mode_offset, duration, earliest_start);
+        typed_profile.add(mode_offset, start_time, start_time + duration);
+        start_times[job_index] = start_time;
+        finish_times[job_index] = start_time + duration;
+        makespan = std::max(makespan, finish_times[job_index]);
+        prefix_makespans[position] = makespan;
+        decoded_activity_list[position] = job_index;
+        decoded_job_modes[job_index] = job_modes[job_index];
+    }
+    used_horizon = makespan;
+    serial_decoded = true;
+    return makespan;
+}
+
+size_t ScheduleDecoder::decode_parallel(const std::vector<size_t> &activity_list, const std::vector<size_t> &job_modes)
+{
+    PPK_ASSERT_ERROR(activity_list.size() == nb_jobs && job_modes.size() == nb_jobs,
+                     "one position and one mode per job are expected");
+
+    std::visit([this](auto &typed_profile) { typed_profile.clear(used_horizon); }, profile);
+    serial_decoded = false;
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        nb_unscheduled_predecessors[job_index] = predecessor_offsets[job_index + 1] - predecessor_offsets[job_index];
+        earliest_starts[job_index] = release_times[job_index];
+        scheduled[job_index] = false;
+    }
+
+    size_t makespan = 0;
+    size_t nb_scheduled = 0;
+    size_t first_position = 0;
+    for (size_t time = 0; nb_scheduled < nb_jobs;)
+    {
+        // the next decision point is the next finish time or the next time a job becomes available
+        size_t next_time = std::numeric_limits<size_t>::max();
+        for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+        {
+            if (scheduled[job_index] && finish_times[job_index] > time)
+            {
+                next_time = std::min(next_time, finish_times[job_index]);
+            }
+        }
+
+        // the available jobs start at the decision point in activity list order while the resources allow it
+        for (size_t position = first_position; position < nb_jobs; ++position)
+        {
+            const size_t job_index = activity_list[position];
+            if (scheduled[job_index])
+            {
+                first_position += position == first_position ? 1 : 0;
+                continue;
+            }
+            if (nb_unscheduled_predecessors[job_index] > 0)
+            {
+                continue;
+            }
+            if (earliest_starts[job_index] > time)
+            {
+                next_time = std::min(next_time, earliest_starts[job_index]);
+                continue;
+            }
+
+            const size_t mode_offset = mode_offsets[job_index] + job_modes[job_index];
+            if (!fits(mode_offset, time))
+            {
+                continue;
+            }
+            place(job_index, mode_offset, time);
+            scheduled[job_index] = true;
+            ++nb_scheduled;
+            first_position += position == first_position ? 1 : 0;
+            makespan = std::max(makespan, finish_times[job_index]);
+            // a job of zero duration releases its successors at the same decision point
+            next_time = std::min(next_time, finish_times[job_index]);
+
+            for (size_t k = successor_offsets[job_index]; k < successor_offsets[job_index + 1]; ++k)
+            {
+                const size_t succ_index = successor_indices[k];
+                --nb_unscheduled_predecessors[succ_index];
+                earliest_starts[succ_index] = std::max(earliest_starts[succ_index], finish_times[job_index]);
+            }
+        }
+
+        PPK_ASSERT_ERROR(nb_scheduled == nb_jobs || next_time != std::numeric_limits<size_t>::max(),
+                         "a mode exceeding a resource capacity was selected");
+        time = next_time;
+    }
+    used_horizon = makespan;
+    return makespan;
+}
+
+bool ScheduleDecoder::fits(size_t mode_offset, size_t start_time) const
+{
+    const size_t finish_time = start_time + durations[mode_offset];
+    PPK_ASSERT_ERROR(finish_time <= horizon, "the start time %zu exceeds the horizon", start_time);
+    return std::visit(
+        [mode_offset, start_time, finish_time](const auto &typed_profile) {
+            return typed_profile.fits(mode_offset, start_time, finish_time);
+        },
+        profile);
+}
+
+void ScheduleDecoder::place(size_t job_index, size_t mode_offset, size_t start_time)
+{
+    const size_t finish_time = start_time + durations[mode_offset];
+    std::visit(
+        [mode_offset, start_time, finish_time](auto &typed_profile) {
+            typed_profile.add(mode_offset, start_time, finish_time);
+        },
+        profile);
+    start_times[job_index] = start_time;
+    finish_times[job_index] = finish_time;
+}
+
+void ScheduleDecoder::unplace(size_t job_index, size_t mode_offset)
+{
+    std::visit(
+        [this, job_index, mode_offset](auto &typed_profile) {
+            typed_profile.remove(mode_offset, start_times[job_index], finish_times[job_index]);
+        },
+        profile);
+}
+
+const std::vector<size_t> &ScheduleDecoder::get_start_times() const { return start_times; }
+
+std::vector<JobAllocation> ScheduleDecoder::get_job_allocations(const std::vector<size_t> &job_modes) const
+{
+    std::vector<JobAllocation> job_allocations(nb_jobs);
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        JobAllocation &job_allocation = job_allocations[job_index];
+        job_allocation.job_id = precedence_graph.get_job(job_index)->id;
+        job_allocation.start_time = start_times[job_index];
+        job_allocation.duration = get_duration(job_index, job_modes[job_index]);
+        job_allocation.mode_id = job_modes[job_index] + 1;
+    }
+    return job_allocations;
+}
+
+const PrecedenceGraph &ScheduleDecoder::get_precedence_graph() const { return precedence_graph; }
+
+size_t ScheduleDecoder::get_nb_jobs() const { return nb_jobs; }
+
+size_t ScheduleDecoder::get_nb_resources() const { return nb_resources; }
+
+size_t ScheduleDecoder::get_nb_modes(size_t job_index) const
+{
+    return mode_offsets[job_index + 1] - mode_offsets[job_index];
+}
+
+size_t ScheduleDecoder::get_duration(size_t job_index, size_t mode_index) const
+{
+    return durations[mode_offsets[job_index] + mode_index];
+}
+
+size_t ScheduleDecoder::get_demand(size_t job_index, size_t mode_index, size_t resource_index) const
+{
+    return demands[(mode_offsets[job_index] + mode_index) * nb_resources + resource_index];
+}
+
+size_t ScheduleDecoder::get_capacity(size_t resource_index) const { return capacities[resource_index]; }
+
+bool ScheduleDecoder::is_executable(size_t job_index, size_t mode_index) const
+{
+    for (size_t r = 0; r < nb_resources; ++r)
+    {
+        if (get_demand(job_index, mode_index, r) > capacities[r])
+        {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,143 @@
+#include "Algorithms/ScheduleGeneration/ScheduleEncoding.hpp"
+#include "External/pempek_assert.hpp"
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+ScheduleEncoding make_random_encoding(const ScheduleDecoder &decoder, RandomGenerator &generator)
+{
+    const PrecedenceGraph &precedence_graph = decoder.get_precedence_graph();
+    const size_t nb_jobs = decoder.get_nb_jobs();
+
+    std::vector<size_t> nb_unlisted_predecessors(nb_jobs);
+    std::vector<size_t> eligible_jobs;
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        nb_unlisted_predecessors[job_index] = precedence_graph.get_predecessors(job_index).size();
+        if (nb_unlisted_predecessors[job_index] == 0)
+        {
+            eligible_jobs.emplace_back(job_index);
+        }
+    }
+
+    ScheduleEncoding encoding;
+    while (!eligible_jobs.empty())
+    {
+        const size_t selected = generator.uniform_index(eligible_jobs.size());
+        const size_t job_index = eligible_jobs[selected];
+        eligible_jobs[selected] = eligible_jobs.back();
+        eligible_jobs.pop_back();
+        encoding.activity_list.emplace_back(job_index);
+        for (size_t succ_index : precedence_graph.get_successors(job_index))
+        {
+            if (--nb_unlisted_predecessors[succ_index] == 0)
+            {
+                eligible_jobs.emplace_back(succ_index);
+            }
+        }
+    }
+    PPK_ASSERT_ERROR(encoding.activity_list.size() == nb_jobs, "the precedence graph has a cycle");
+
+    // an out of range mode is repaired like a non-executable one
+    encoding.job_modes.assign(nb_jobs, std::numeric_limits<size_t>::max());
+    repair_modes(decoder, encoding.job_modes, generator);
+    return encoding;
+}
+
+ScheduleEncoding make_encoding(ScheduleDecoder &decoder, const std::vector<JobAllocation> &job_allocations)
+{
+    const PrecedenceGraph &precedence_graph = decoder.get_precedence_graph();
+    const size_t nb_jobs = decoder.get_nb_jobs();
+    PPK_ASSERT_ERROR(job_allocations.size() == nb_jobs, "one allocation per job is expected");
+
+    std::vector<size_t> topological_ranks(nb_jobs);
+    const std::vector<size_t> &topological_order = precedence_graph.get_topological_order();
+    for (size_t rank = 0; rank < nb_jobs; ++rank)
+    {
+        topological_ranks[topological_order[rank]] = rank;
+    }
+
+    ScheduleEncoding encoding;
+    encoding.job_modes.resize(nb_jobs);
+    std::vector<size_t> start_times(nb_jobs);
+    for (const auto &job_allocation : job_allocations)
+    {
+        const size_t job_index = precedence_graph.get_job_index(job_allocation.job_id);
+        PPK_ASSERT_ERROR(job_allocation.mode_id >= 1 && job_allocation.mode_id <= decoder.get_nb_modes(job_index),
+                         "job %s has no mode %zu", job_allocation.job_id.c_str(), job_allocation.mode_id);
+        encoding.job_modes[job_index] = job_allocation.mode_id - 1;
+        start_times[job_index] = job_allocation.start_time;
+    }
+
+    encoding.activity_list = topological_order;
+    std::ranges::sort(encoding.activity_list, [&start_times, &topological_ranks](size_t first, size_t second) {
+        return std::tie(start_times[first], topological_ranks[first]) <
+               std::tie(start_times[second], topological_ranks[second]);
+    });
+    encoding.makespan = decoder.decode(encoding.activity_list, encoding.job_modes);
+    return encoding;
+}
+
+std::optional<ScheduleEncoding> import_incumbent(ScheduleDecoder &decoder, const IncumbentStore *incumbent_source,
+                                                 SharedIncumbent &shared_incumbent)
+{
+    const std::optional<Incumbent> incumbent = shared_incumbent.get_import(incumbent_source);
+    if (!incumbent)
+    {
+        return std::nullopt;
+    }
+    ScheduleEncoding encoding = make_encoding(decoder, incumbent->job_allocations);
+    shared_incumbent.offer_import(encoding.makespan, incumbent->makespan,
+                                  decoder.get_job_allocations(encoding.job_modes));
+    return encoding;
+}
+
+void repair_modes(const ScheduleDecoder &decoder, std::vector<size_t> &job_modes, RandomGenerator &generator)
+{
+    for (size_t job_index = 0; job_index < job_modes.size(); ++job_index)
+    {
+        const size_t nb_modes = decoder.get_nb_modes(job_index);
+        if (job_modes[job_index] < nb_modes && decoder.is_executable(job_index, job_modes[job_index]))
+        {
+            continue;
+        }
+
+        size_t nb_executable_modes = 0;
+        for (size_t mode_index = 0; mode_index < nb_modes; ++mode_index)
+        {
+            nb_executable_modes += decoder.is_executable(job_index, mode_index) ? 1 : 0;
+        }
+        PPK_ASSERT_ERROR(nb_executable_modes > 0, "Job %s has no executable mode",
+                         decoder.get_precedence_graph().get_job(job_index)->id.c_str());
+
+        size_t rank = generator.uniform_index(nb_executable_modes);
+        for (size_t mode_index = 0; mode_index < nb_modes; ++mode_index)
+        {
+            if (decoder.is_executable(job_index, mode_index) && rank-- == 0)
+            {
+                job_modes[job_index] = mode_index;
+                break;
+            }
+        }
+    }
+}
+
+bool is_precedence_feasible(const PrecedenceGraph &precedence_graph, const std::vector<size_t> &activity_list)
+{
+    std::vector<size_t> positions(precedence_graph.get_nb_jobs());
+    for (size_t position = 0; position < activity_list.size(); ++position)
+    {
+        positions[activity_list[position]] = position;
+    }
+    for (size_t job_index = 0; job_index < precedence_graph.get_nb_jobs(); ++job_index)
+    {
+        for (size_t succ_index : precedence_graph.get_successors(job_index))
+        {
+            if (positions[succ_index] < positions[job_index])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,272 @@
+#include "Algorithms/ScheduleGeneration/ScheduleJustification.hpp"
+#include "Algorithms/ScheduleGeneration/ResourceProfileTree.hpp"
+#include "External/pempek_assert.hpp"
+#include "ProblemInstance/PrecedenceGraph.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace
+{
+struct JustifiedJob
+{
+    size_t duration;
+    std::vector<long long> demands;
+};
+
+class ScheduleJustifier
+{
+  public:
+    ScheduleJustifier(const ProblemInstance &problem_instance, const Solution &solution);
+
+    size_t get_makespan() const;
+    void write_start_times(Solution &solution) const;
+
+    void justify_right();
+    void justify_left();
+
+  private:
+    size_t find_latest_start(size_t job_index, size_t latest_finish) const;
+    size_t find_earliest_start(size_t job_index, size_t earliest_start) const;
+    void place(size_t job_index, size_t start_time);
+    void clear_profiles();
+
+    PrecedenceGraph precedence_graph;
+    std::vector<long long> capacities;
+    std::vector<JustifiedJob> jobs;
+    std::vector<size_t> topological_ranks;
+    std::vector<size_t> start_times;
+    std::vector<ResourceProfileTree> profiles;
+};
+
+ScheduleJustifier::ScheduleJustifier(const ProblemInstance &problem_instance, const Solution &solution)
+    : precedence_graph(problem_instance)
+{
+    const size_t nb_jobs = precedence_graph.get_nb_jobs();
+    PPK_ASSERT_ERROR(solution.job_allocations.size() == nb_jobs, "one allocation per job is expected");
+
+    for (const auto &resource : problem_instance.get_resources())
+    {
+        capacities.emplace_back(static_cast<long long>(resource.units));
+    }
+
+    jobs.resize(nb_jobs);
+    start_times.resize(nb_jobs);
+    for (const auto &job_allocation : solution.job_allocations)
+    {
+        const size_t job_index = precedence_graph.get_job_index(job_allocation.job_id);
+        const auto &modes = precedence_graph.get_job(job_index)->modes;
+        PPK_ASSERT_ERROR(job_allocation.mode_id > 0 && job_allocation.mode_id <= modes.size(),
+                         "Invalid mode %zu of job %s", job_allocation.mode_id, job_allocation.job_id.c_str());
+
+        JustifiedJob &job = jobs[job_index];
+        job.duration = job_allocation.duration;
+        for (const auto &requested_resource : modes[job_allocation.mode_id - 1].requested_resources)
+        {
+            job.demands.emplace_back(static_cast<long long>(requested_resource.units));
+        }
+        start_times[job_index] = job_allocation.start_time;
+    }
+
+    topological_ranks.resize(nb_jobs);
+    const auto &topological_order = precedence_graph.get_topological_order();
+    for (size_t rank = 0; rank < topological_order.size(); ++rank)
+    {
+        topological_ranks[topological_order[rank]] = rank;
+    }
+
+    profiles.assign(capacities.size(), ResourceProfileTree(get_makespan()));
+}
+
+size_t ScheduleJustifier::get_makespan() const
+{
+    size_t makespan = 0;
+    for (size_t job_index = 0; job_index < jobs.size(); ++job_index)
+    {
+        makespan = std::max(makespan, start_times[job_index] + jobs[job_index].duration);
+    }
+    return makespan;
+}
+
+void ScheduleJustifier::write_start_times(Solution &solution) const
+{
+    for (auto &job_allocation : solution.job_allocations)
+    {
+        const size_t start_time = start_times[precedence_graph.get_job_index(job_allocation.job_id)];
+        if (start_time != job_allocation.start_time)
+        {
+            // the units given to the job are assigned again from the new start time when they are written
+            job_allocation.start_time = start_time;
+            job_allocation.units_map.clear();
+        }
+    }
+}
+
+void ScheduleJustifier::justify_right()
+{
+    // by decreasing finish time, a successor of equal finish time being placed first
+    std::vector<size_t> order(jobs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(order, [this](size_t lhs, size_t rhs) {
+        const size_t lhs_finish = start_times[lhs] + jobs[lhs].duration;
+        const size_t rhs_finish = start_times[rhs] + jobs[rhs].duration;
+        if (lhs_finish != rhs_finish)
+        {
+            return lhs_finish > rhs_finish;
+        }
+        if (start_times[lhs] != start_times[rhs])
+        {
+            return start_times[lhs] > start_times[rhs];
+        }
+        return topological_ranks[lhs] > topological_ranks[rhs];
+    });
+
+    clear_profiles();
+    const size_t makespan = get_makespan();
+    for (size_t job_index : order)
+    {
+        size_t latest_finish = makespan;
+        for (size_t succ_index : precedence_graph.get_successors(job_index))
+        {
+            latest_finish = std::min(latest_finish, start_times[succ_index]);
+        }
+        place(job_index, find_latest_start(job_index, latest_finish));
+    }
+}
+
+void ScheduleJustifier::justify_left()
+{
+    // by increasing start time, a predecessor of equal start time being placed first
+    std::vector<size_t> order(jobs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::sort(order, [this](size_t lhs, size_t rhs) {
+        if (start_times[lhs] != start_times[rhs])
+        {
+            return start_times[lhs] < start_times[rhs];
+        }
+        return topological_ranks[lhs] < topological_ranks[rhs];
+    });
+
+    clear_profiles();
+    for (size_t job_index : order)
+    {
+        size_t earliest_start = precedence_graph.get_release_time(job_index);
+        for (size_t pred_index : precedence_graph.get_predecessors(job_index))
+        {
+            earliest_start = std::max(earliest_start, start_times[pred_index] + jobs[pred_index].duration);
+        }
+        place(job_index, find_earliest_start(job_index, earliest_start));
+    }
+}
+
+size_t ScheduleJustifier::find_latest_start(size_t job_index, size_t latest_finish) const
+{
+    // the earliest conflict of the window moves the finish time directly onto it
+    const JustifiedJob &job = jobs[job_index];
+    for (size_t finish_time = latest_finish;;)
+    {
+        PPK_ASSERT_ERROR(finish_time >= job.duration, "the schedule of job %s is not feasible",
+                         precedence_graph.get_job(job_index)->id.c_str());
+        const size_t start_time = finish_time - job.duration;
+        size_t conflict = ResourceProfileTree::npos;
+        for (size_t r = 0; r < profiles.size(); ++r)
+        {
+            if (job.demands[r] > 0)
+            {
+                conflict = std::min(conflict, profiles[r].find_first_above(start_time, finish_time,
+                                                                           capacities[r] - job.demands[r]));
+            }
+        }
+        if (conflict == ResourceProfileTree::npos)
+        {
+            return start_time;
+        }
+        finish_time = conflict;
+    }
+}
+
+size_t ScheduleJustifier::find_earliest_start(size_t job_index, size_t earliest_start) const
+{
+    // the latest conflict of the window moves the start time directly after it
+    const JustifiedJob &job = jobs[job_index];
+    for (size_t start_time = earliest_start;;)
+    {
+        PPK_ASSERT_ERROR(start_time + job.duration <= profiles.front().get_horizon(),
+                         "the schedule of job %s is not feasible", precedence_graph.get_job(job_index)->id.c_str());
+        size_t conflict = ResourceProfileTree::npos;
+        for (size_t r = 0; r < profiles.size(); ++r)
+        {
+            if (job.demands[r] == 0)
+            {
+                continue;
+            }
+            const size_t resource_conflict = profiles[r].find_last_above(start_time, start_time + job.duration,
+                                                                         capacities[r] - job.demands[r]);
+            if (resource_conflict != ResourceProfileTree::npos)
+            {
+                conflict = conflict == ResourceProfileTree::npos ? resource_conflict
+                                                                 : std::max(conflict, resource_conflict);
+            }
+        }
+        if (conflict == ResourceProfileTree::npos)
+        {
+            return start_time;
+        }
+        start_time = conflict + 1;
+    }
+}
+
+void ScheduleJustifier::place(size_t job_index, size_t start_time)
+{
+    const JustifiedJob &job = jobs[job_index];
+    for (size_t r = 0; r < profiles.size(); ++r)
+    {
+        if (job.demands[r] > 0)
+        {
+            profiles[r].add(start_time, start_time + job.duration, job.demands[r]);
+        }
+    }
+    start_times[job_index] = start_time;
+}
+
+void ScheduleJustifier::clear_profiles()
+{
+    // the horizon of the first pass bounds every later schedule
+    const size_t horizon = profiles.empty() ? 0 : profiles.front().get_horizon();
+    profiles.assign(profiles.size(), ResourceProfileTree(horizon));
+}
+} // namespace
+
+bool justify_schedule(const ProblemInstance &problem_instance, Solution &solution)
+{
+    ScheduleJustifier justifier(problem_instance, solution);
+    const size_t initial_makespan = justifier.get_makespan();
+    size_t makespan = initial_makespan;
+    while (true)
+    {
+        justifier.justify_right();
+        justifier.justify_left();
+        const size_t justified_makespan = justifier.get_makespan();
+        if (justified_makespan >= makespan)
+        {
+            break;
+        }
+        makespan = justified_makespan;
+    }
+    if (makespan >= initial_makespan)
+    {
+        return false;
+    }
+
+    justifier.write_start_times(solution);
+    solution.makespan = makespan;
+    if (solution.objective_bound > 0.0)
+    {
+        solution.gap = (static_cast<double>(makespan) - solution.objective_bound) / static_cast<double>(makespan);
+        if (static_cast<double>(makespan) <= std::ceil(solution.objective_bound))
+        {
+            solution.solution_state = SolutionState::OPTIMAL;
+        }
+    }
+    return true;
+}
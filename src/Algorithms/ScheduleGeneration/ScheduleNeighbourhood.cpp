@@ -0,0 +1,203 @@
+#include "Algorithms/ScheduleGeneration/ScheduleNeighbourhood.hpp"
+#include "External/pempek_assert.hpp"
+#include <algorithm>
+
+ScheduleNeighbourhood::ScheduleNeighbourhood(const ScheduleDecoder &decoder, ScheduleEncoding encoding)
+    : precedence_graph(decoder.get_precedence_graph())
+{
+    const size_t nb_jobs = decoder.get_nb_jobs();
+    set_encoding(std::move(encoding));
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        std::vector<size_t> job_executable_modes;
+        for (size_t mode_index = 0; mode_index < decoder.get_nb_modes(job_index); ++mode_index)
+        {
+            if (decoder.is_executable(job_index, mode_index))
+            {
+                job_executable_modes.emplace_back(mode_index);
+            }
+        }
+        if (job_executable_modes.size() > 1)
+        {
+            multi_mode_jobs.emplace_back(job_index);
+        }
+        executable_modes.emplace_back(std::move(job_executable_modes));
+    }
+}
+
+const ScheduleEncoding &ScheduleNeighbourhood::get_encoding() const { return encoding; }
+
+void ScheduleNeighbourhood::set_encoding(ScheduleEncoding encoding)
+{
+    const size_t nb_jobs = precedence_graph.get_nb_jobs();
+    PPK_ASSERT_ERROR(encoding.activity_list.size() == nb_jobs && encoding.job_modes.size() == nb_jobs,
+                     "one position and one mode per job are expected");
+    PPK_ASSERT_ERROR(is_precedence_feasible(precedence_graph, encoding.activity_list),
+                     "the activity list is not precedence feasible");
+
+    this->encoding = std::move(encoding);
+    positions.resize(nb_jobs);
+    for (size_t position = 0; position < nb_jobs; ++position)
+    {
+        positions[this->encoding.activity_list[position]] = position;
+    }
+}
+
+void ScheduleNeighbourhood::set_makespan(size_t makespan) { encoding.makespan = makespan; }
+
+size_t ScheduleNeighbourhood::get_position(size_t job_index) const { return positions[job_index]; }
+
+ScheduleMove ScheduleNeighbourhood::sample_move(RandomGenerator &generator) const
+{
+    // a few attempts cover the jobs fixed between a predecessor and a successor
+    constexpr size_t max_attempts = 16;
+    ScheduleMove move;
+    for (size_t attempt = 0; attempt < max_attempts; ++attempt)
+    {
+        const size_t type = generator.uniform_index(3);
+        const bool sampled = type == 0   ? sample_shift(generator, move)
+                             : type == 1 ? sample_swap(generator, move)
+                                         : sample_mode_change(generator, move);
+        if (sampled)
+        {
+            return move;
+        }
+    }
+    return {};
+}
+
+bool ScheduleNeighbourhood::sample_shift(RandomGenerator &generator, ScheduleMove &move) const
+{
+    const size_t nb_jobs = encoding.activity_list.size();
+    const size_t position = generator.uniform_index(nb_jobs);
+    const auto [first, last] = get_shift_window(position);
+    if (first == last)
+    {
+        return false;
+    }
+
+    // the position itself is skipped
+    size_t to_position = generator.uniform_int<size_t>(first, last - 1);
+    to_position += to_position >= position ? 1 : 0;
+    move = {ScheduleMoveType::SHIFT, position, to_position, 0};
+    return true;
+}
+
+bool ScheduleNeighbourhood::sample_swap(RandomGenerator &generator, ScheduleMove &move) const
+{
+    const size_t nb_jobs = encoding.activity_list.size();
+    const size_t position = generator.uniform_index(nb_jobs);
+    const auto [first, last] = get_shift_window(position);
+    if (last <= position)
+    {
+        return false;
+    }
+
+    // the first job may move up to its window end, the second one must not have a predecessor after position
+    const size_t other_position = generator.uniform_int<size_t>(position + 1, last);
+    for (size_t pred_index : precedence_graph.get_predecessors(encoding.activity_list[other_position]))
+    {
+        if (positions[pred_index] >= position)
+        {
+            return false;
+        }
+    }
+    move = {ScheduleMoveType::SWAP, position, other_position, 0};
+    return true;
+}
+
+bool ScheduleNeighbourhood::sample_mode_change(RandomGenerator &generator, ScheduleMove &move) const
+{
+    if (multi_mode_jobs.empty())
+    {
+        return false;
+    }
+
+    const size_t job_index = multi_mode_jobs[generator.uniform_index(multi_mode_jobs.size())];
+    const auto &job_executable_modes = executable_modes[job_index];
+    size_t mode_index = job_executable_modes[generator.uniform_index(job_executable_modes.size() - 1)];
+    if (mode_index == encoding.job_modes[job_index])
+    {
+        mode_index = job_executable_modes.back();
+    }
+    move = {ScheduleMoveType::MODE_CHANGE, job_index, mode_index, encoding.job_modes[job_index]};
+    return true;
+}
+
+std::pair<size_t, size_t> ScheduleNeighbourhood::get_shift_window(size_t position) const
+{
+    const size_t job_index = encoding.activity_list[position];
+    size_t first = 0;
+    for (size_t pred_index : precedence_graph.get_predecessors(job_index))
+    {
+        first = std::max(first, positions[pred_index] + 1);
+    }
+    size_t last = encoding.activity_list.size() - 1;
+    for (size_t succ_index : precedence_graph.get_successors(job_index))
+    {
+        last = std::min(last, positions[succ_index] - 1);
+    }
+    return {first, last};
+}
+
+void ScheduleNeighbourhood::apply(const ScheduleMove &move)
+{
+    switch (move.type)
+    {
+    case ScheduleMoveType::SHIFT:
+        shift(move.first, move.second);
+        break;
+    case ScheduleMoveType::SWAP:
+        std::swap(encoding.activity_list[move.first], encoding.activity_list[move.second]);
+        positions[encoding.activity_list[move.first]] = move.first;
+        positions[encoding.activity_list[move.second]] = move.second;
+        break;
+    case ScheduleMoveType::MODE_CHANGE:
+        encoding.job_modes[move.first] = move.second;
+        break;
+    }
+}
+
+void ScheduleNeighbourhood::undo(const ScheduleMove &move)
+{
+    switch (move.type)
+    {
+    case ScheduleMoveType::SHIFT:
+        shift(move.second, move.first);
+        break;
+    case ScheduleMoveType::SWAP:
+        apply(move);
+        break;
+    case ScheduleMoveType::MODE_CHANGE:
+        encoding.job_modes[move.first] = move.previous_mode;
+        break;
+    }
+}
+
+size_t ScheduleNeighbourhood::get_first_changed_position(const ScheduleMove &move) const
+{
+    if (move.type == ScheduleMoveType::MODE_CHANGE)
+    {
+        return positions[move.first];
+    }
+    return std::min(move.first, move.second);
+}
+
+void ScheduleNeighbourhood::shift(size_t from_position, size_t to_position)
+{
+    auto &activity_list = encoding.activity_list;
+    const auto from = activity_list.begin() + static_cast<std::ptrdiff_t>(from_position);
+    const auto to = activity_list.begin() + static_cast<std::ptrdiff_t>(to_position);
+    if (from_position < to_position)
+    {
+        std::rotate(from, from + 1, to + 1);
+    } else
+    {
+        std::rotate(to, from, from + 1);
+    }
+    for (size_t position = std::min(from_position, to_position); position <= std::max(from_position, to_position);
+         ++position)
+    {
+        positions[activity_list[position]] = position;
+    }
+}
@@ -0,0 +1,226 @@
+#include "Algorithms/SimulatedAnnealing/SimulatedAnnealing.hpp"
+#include "External/pempek_assert.hpp"
+#include "ProblemInstance/PrecedenceGraph.hpp"
+#include "Settings.hpp"
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <thread>
+
+SimulatedAnnealing::SearchState::SearchState(std::vector<IncumbentListener> listeners, size_t makespan_lower_bound,
+                                             size_t nb_replicas, uint64_t seed,
+                                             std::chrono::steady_clock::time_point start,
+                                             std::chrono::steady_clock::time_point deadline)
+    : start(start), deadline(deadline), temperatures(nb_replicas, 0.0), replica_makespans(nb_replicas, 0),
+      replica_at_rank(nb_replicas, 0), exchange_generator(seed, nb_replicas),
+      shared_incumbent(std::move(listeners), makespan_lower_bound)
+{
+    for (size_t rank = 0; rank < nb_replicas; ++rank)
+    {
+        replica_at_rank[rank] = rank;
+    }
+}
+
+void SimulatedAnnealing::RoundCompletion::operator()() const noexcept
+{
+    simulated_annealing->end_round(*search_state);
+}
+
+SimulatedAnnealing::SimulatedAnnealing(const ProblemInstance &problem_instance) : problem_instance(problem_instance)
+{
+    const PrecedenceGraph precedence_graph(problem_instance);
+    makespan_lower_bound =
+        std::max(precedence_graph.compute_critical_path_length(), problem_instance.compute_energy_lower_bound());
+}
+
+void SimulatedAnnealing::add_incumbent_listener(IncumbentListener listener)
+{
+    incumbent_listeners.emplace_back(std::move(listener));
+}
+
+void SimulatedAnnealing::set_stop_token(std::stop_token stop_token) { this->stop_token = std::move(stop_token); }
+
+void SimulatedAnnealing::set_incumbent_source(const IncumbentStore &incumbent_store)
+{
+    incumbent_source = &incumbent_store;
+}
+
+void SimulatedAnnealing::set_seed(uint64_t seed) { random_seed = seed; }
+
+Solution SimulatedAnnealing::solve()
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                      std::chrono::duration<double>(Settings::Solver::MAX_RUNTIME));
+    const size_t nb_replicas = Settings::Solver::SA_REPLICAS > 0 ? Settings::Solver::SA_REPLICAS
+                                                                 : std::max<size_t>(Settings::Solver::NB_THREADS, 1);
+
+    SearchState search_state(incumbent_listeners, makespan_lower_bound, nb_replicas, random_seed, start, deadline);
+    update_temperatures(search_state);
+    std::barrier<RoundCompletion> barrier(static_cast<std::ptrdiff_t>(nb_replicas),
+                                          RoundCompletion{this, &search_state});
+    {
+        std::vector<std::jthread> workers;
+        for (size_t replica_index = 0; replica_index < nb_replicas; ++replica_index)
+        {
+            workers.emplace_back([this, replica_index, &search_state, &barrier] {
+                try
+                {
+                    run_replica(replica_index, search_state, barrier);
+                } catch (...)
+                {
+                    {
+                        std::scoped_lock lock(search_state.exception_mutex);
+                        if (!search_state.worker_exception)
+                        {
+                            search_state.worker_exception = std::current_exception();
+                        }
+                    }
+                    // the other replicas stop at the end of the round
+                    search_state.stopped.store(true);
+                    barrier.arrive_and_drop();
+                }
+            });
+        }
+    }
+
+    if (search_state.worker_exception)
+    {
+        std::rethrow_exception(search_state.worker_exception);
+    }
+
+    Solution solution;
+    solution.solver_configuration =
+        std::format("SimulatedAnnealing replicas={} rounds={} exchanges={}", nb_replicas, search_state.nb_rounds,
+                    search_state.nb_exchanges);
+    solution.runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    search_state.shared_incumbent.complete_solution(solution);
+    return solution;
+}
+
+void SimulatedAnnealing::run_replica(size_t replica_index, SearchState &search_state,
+                                     std::barrier<RoundCompletion> &barrier) const
+{
+    ScheduleDecoder decoder(problem_instance);
+    RandomGenerator generator(random_seed, replica_index);
+    ScheduleNeighbourhood neighbourhood(decoder, make_random_encoding(decoder, generator));
+    const ScheduleEncoding &encoding = neighbourhood.get_encoding();
+    size_t makespan = decoder.decode(encoding.activity_list, encoding.job_modes);
+    neighbourhood.set_makespan(makespan);
+    publish(search_state, decoder, encoding);
+
+    while (true)
+    {
+        // the ranks are only written between two rounds, a single replica is the coldest one
+        if (search_state.replica_at_rank.front() == replica_index)
+        {
+            if (std::optional<ScheduleEncoding> imported =
+                    import_incumbent(decoder, incumbent_source, search_state.shared_incumbent))
+            {
+                makespan = imported->makespan;
+                neighbourhood.set_encoding(std::move(*imported));
+            }
+        }
+
+        const double temperature = search_state.temperatures[replica_index];
+        for (size_t move_index = 0; move_index < Settings::Solver::SA_ROUND_MOVES; ++move_index)
+        {
+            if (move_index % 64 == 0 &&
+                (std::chrono::steady_clock::now() >= search_state.deadline || search_state.stopped.load() ||
+                 stop_token.stop_requested() ||
+                 search_state.shared_incumbent.reached_lower_bound()))
+            {
+                break;
+            }
+
+            // the decoder only replaces the schedule after the first position the move changed, a rejected move
+            // is undone in the encoding and left to the next decode to compare against
+            const ScheduleMove move = neighbourhood.sample_move(generator);
+            neighbourhood.apply(move);
+            const size_t candidate_makespan = decoder.redecode(encoding.activity_list, encoding.job_modes);
+            const bool accepted =
+                candidate_makespan <= makespan ||
+                generator.uniform_real() <
+                    std::exp(-static_cast<double>(candidate_makespan - makespan) / temperature);
+            if (!accepted)
+            {
+                neighbourhood.undo(move);
+                continue;
+            }
+
+            makespan = candidate_makespan;
+            neighbourhood.set_makespan(makespan);
+            if (makespan < search_state.shared_incumbent.get_best_makespan())
+            {
+                publish(search_state, decoder, encoding);
+            }
+        }
+
+        search_state.replica_makespans[replica_index] = makespan;
+        barrier.arrive_and_wait();
+        if (search_state.stopped.load())
+        {
+            return;
+        }
+    }
+}
+
+void SimulatedAnnealing::end_round(SearchState &search_state) const noexcept
+{
+    ++search_state.nb_rounds;
+    if (std::chrono::steady_clock::now() >= search_state.deadline || stop_token.stop_requested() ||
+        search_state.shared_incumbent.reached_lower_bound())
+    {
+        search_state.stopped.store(true);
+    }
+
+    // the even and odd pairs of neighbouring ranks alternate, a colder replica takes the higher temperature of a
+    // better schedule with probability exp((1 / T_cold - 1 / T_hot) * (E_cold - E_hot))
+    auto &replica_at_rank = search_state.replica_at_rank;
+    for (size_t rank = search_state.nb_rounds % 2; rank + 1 < replica_at_rank.size(); rank += 2)
+    {
+        const size_t cold_replica = replica_at_rank[rank];
+        const size_t hot_replica = replica_at_rank[rank + 1];
+        const double inverse_temperature_difference = 1.0 / search_state.temperatures[cold_replica] -
+                                                      1.0 / search_state.temperatures[hot_replica];
+        const double energy_difference = static_cast<double>(search_state.replica_makespans[cold_replica]) -
+                                         static_cast<double>(search_state.replica_makespans[hot_replica]);
+        if (search_state.exchange_generator.uniform_real() <
+            std::exp(inverse_temperature_difference * energy_difference))
+        {
+            std::swap(replica_at_rank[rank], replica_at_rank[rank + 1]);
+            ++search_state.nb_exchanges;
+        }
+    }
+    update_temperatures(search_state);
+}
+
+void SimulatedAnnealing::update_temperatures(SearchState &search_state) const
+{
+    const double runtime = std::chrono::duration<double>(search_state.deadline - search_state.start).count();
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - search_state.start).count();
+    const double progress = runtime > 0.0 ? std::clamp(elapsed / runtime, 0.0, 1.0) : 1.0;
+
+    // the temperatures are relative to the makespan lower bound so that they do not depend on the time unit
+    const double scale = static_cast<double>(std::max<size_t>(makespan_lower_bound, 1));
+    const double initial_temperature = Settings::Solver::SA_INITIAL_TEMPERATURE * scale;
+    const double coldest_temperature = initial_temperature * std::pow(Settings::Solver::SA_FINAL_TEMPERATURE /
+                                                                          Settings::Solver::SA_INITIAL_TEMPERATURE,
+                                                                      progress);
+
+    const size_t nb_replicas = search_state.replica_at_rank.size();
+    for (size_t rank = 0; rank < nb_replicas; ++rank)
+    {
+        const double ladder_position =
+            nb_replicas > 1 ? static_cast<double>(rank) / static_cast<double>(nb_replicas - 1) : 0.0;
+        search_state.temperatures[search_state.replica_at_rank[rank]] =
+            coldest_temperature * std::pow(initial_temperature / coldest_temperature, ladder_position);
+    }
+}
+
+void SimulatedAnnealing::publish(SearchState &search_state, const ScheduleDecoder &decoder,
+                                 const ScheduleEncoding &encoding) const
+{
+    // the decoder holds the schedule of the encoding
+    search_state.shared_incumbent.offer(encoding.makespan, decoder.get_job_allocations(encoding.job_modes));
+}
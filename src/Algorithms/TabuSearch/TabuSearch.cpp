@@ -0,0 +1,272 @@
+#include "Algorithms/TabuSearch/TabuSearch.hpp"
+#include "External/pempek_assert.hpp"
+#include "ProblemInstance/PrecedenceGraph.hpp"
+#include "Settings.hpp"
+#include <algorithm>
+#include <format>
+#include <limits>
+#include <thread>
+
+TabuSearch::SearchState::SearchState(std::vector<IncumbentListener> listeners, size_t makespan_lower_bound,
+                                     const ProblemInstance &problem_instance, size_t nb_workers, uint64_t seed,
+                                     std::chrono::steady_clock::time_point deadline)
+    : deadline(deadline), worker_candidates(nb_workers), selection_generator(seed, nb_workers),
+      decoder(problem_instance), shared_incumbent(std::move(listeners), makespan_lower_bound)
+{}
+
+void TabuSearch::IterationCompletion::operator()() const noexcept
+{
+    tabu_search->end_iteration(*search_state);
+}
+
+TabuSearch::TabuSearch(const ProblemInstance &problem_instance) : problem_instance(problem_instance)
+{
+    const PrecedenceGraph precedence_graph(problem_instance);
+    makespan_lower_bound =
+        std::max(precedence_graph.compute_critical_path_length(), problem_instance.compute_energy_lower_bound());
+}
+
+void TabuSearch::add_incumbent_listener(IncumbentListener listener)
+{
+    incumbent_listeners.emplace_back(std::move(listener));
+}
+
+void TabuSearch::set_stop_token(std::stop_token stop_token) { this->stop_token = std::move(stop_token); }
+
+void TabuSearch::set_incumbent_source(const IncumbentStore &incumbent_store)
+{
+    incumbent_source = &incumbent_store;
+}
+
+void TabuSearch::set_seed(uint64_t seed) { random_seed = seed; }
+
+Solution TabuSearch::solve()
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                      std::chrono::duration<double>(Settings::Solver::MAX_RUNTIME));
+    const size_t nb_workers = Settings::Solver::TABU_SEARCH_WORKERS > 0
+                                  ? Settings::Solver::TABU_SEARCH_WORKERS
+                                  : std::max<size_t>(Settings::Solver::NB_THREADS, 1);
+
+    SearchState search_state(incumbent_listeners, makespan_lower_bound, problem_instance, nb_workers, random_seed,
+                             deadline);
+    ScheduleEncoding encoding = make_random_encoding(search_state.decoder, search_state.selection_generator);
+    encoding.makespan = search_state.decoder.decode(encoding.activity_list, encoding.job_modes);
+    search_state.current.emplace(search_state.decoder, encoding);
+    publish(search_state);
+    if (std::optional<ScheduleEncoding> imported =
+            import_incumbent(search_state.decoder, incumbent_source, search_state.shared_incumbent))
+    {
+        search_state.current->set_encoding(std::move(*imported));
+    }
+
+    std::barrier<IterationCompletion> barrier(static_cast<std::ptrdiff_t>(nb_workers),
+                                              IterationCompletion{this, &search_state});
+    {
+        std::vector<std::jthread> workers;
+        for (size_t worker_index = 0; worker_index < nb_workers; ++worker_index)
+        {
+            workers.emplace_back([this, worker_index, &search_state, &barrier] {
+                try
+                {
+                    run_worker(worker_index, search_state, barrier);
+                } catch (...)
+                {
+                    {
+                        std::scoped_lock lock(search_state.exception_mutex);
+                        if (!search_state.worker_exception)
+                        {
+                            search_state.worker_exception = std::current_exception();
+                        }
+                    }
+                    // the other workers stop at the end of the iteration
+                    search_state.stopped.store(true);
+                    barrier.arrive_and_drop();
+                }
+            });
+        }
+    }
+
+    if (search_state.worker_exception)
+    {
+        std::rethrow_exception(search_state.worker_exception);
+    }
+
+    Solution solution;
+    solution.solver_configuration = std::format("TabuSearch workers={} candidates={} tenure={} iterations={}",
+                                                nb_workers, Settings::Solver::TABU_SEARCH_CANDIDATES,
+                                                Settings::Solver::TABU_SEARCH_TENURE, search_state.nb_iterations);
+    solution.runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    search_state.shared_incumbent.complete_solution(solution);
+    return solution;
+}
+
+void TabuSearch::run_worker(size_t worker_index, SearchState &search_state,
+                            std::barrier<IterationCompletion> &barrier) const
+{
+    ScheduleDecoder decoder(problem_instance);
+    RandomGenerator generator(random_seed, worker_index);
+    ScheduleNeighbourhood neighbourhood = *search_state.current;
+    const ScheduleEncoding &encoding = neighbourhood.get_encoding();
+    decoder.decode(encoding.activity_list, encoding.job_modes);
+
+    const size_t nb_workers = search_state.worker_candidates.size();
+    const size_t nb_candidates = Settings::Solver::TABU_SEARCH_CANDIDATES / nb_workers +
+                                 (worker_index < Settings::Solver::TABU_SEARCH_CANDIDATES % nb_workers ? 1 : 0);
+    while (true)
+    {
+        evaluate_candidates(neighbourhood, decoder, nb_candidates, generator,
+                            search_state.worker_candidates[worker_index]);
+        barrier.arrive_and_wait();
+        if (search_state.stopped.load())
+        {
+            return;
+        }
+        if (search_state.restarted)
+        {
+            neighbourhood.set_encoding(search_state.current->get_encoding());
+        } else if (search_state.selected_move)
+        {
+            neighbourhood.apply(*search_state.selected_move);
+        }
+    }
+}
+
+void TabuSearch::evaluate_candidates(ScheduleNeighbourhood &neighbourhood, ScheduleDecoder &decoder,
+                                     size_t nb_candidates, RandomGenerator &generator,
+                                     std::vector<Candidate> &candidates) const
+{
+    std::vector<std::pair<size_t, ScheduleMove>> moves;
+    for (size_t index = 0; index < nb_candidates; ++index)
+    {
+        const ScheduleMove move = neighbourhood.sample_move(generator);
+        moves.emplace_back(neighbourhood.get_first_changed_position(move), move);
+    }
+    std::ranges::sort(moves, std::ranges::greater{}, [](const auto &position_move) { return position_move.first; });
+
+    // every candidate shares with the previous one the prefix before its own first changed position
+    const ScheduleEncoding &encoding = neighbourhood.get_encoding();
+    candidates.clear();
+    for (const auto &[first_changed_position, move] : moves)
+    {
+        neighbourhood.apply(move);
+        candidates.push_back({move, decoder.redecode(encoding.activity_list, encoding.job_modes)});
+        neighbourhood.undo(move);
+    }
+}
+
+void TabuSearch::end_iteration(SearchState &search_state) const noexcept
+{
+    try
+    {
+        select_move(search_state);
+        // the tabu list of the abandoned trajectory does not apply to the imported one
+        search_state.restarted = false;
+        if (std::optional<ScheduleEncoding> imported =
+            import_incumbent(search_state.decoder, incumbent_source, search_state.shared_incumbent))
+        {
+            search_state.current->set_encoding(std::move(*imported));
+            search_state.tabu_list.clear();
+            search_state.restarted = true;
+        }
+    } catch (...)
+    {
+        std::scoped_lock lock(search_state.exception_mutex);
+        if (!search_state.worker_exception)
+        {
+            search_state.worker_exception = std::current_exception();
+        }
+        search_state.stopped.store(true);
+    }
+
+    if (std::chrono::steady_clock::now() >= search_state.deadline || stop_token.stop_requested() ||
+        search_state.shared_incumbent.reached_lower_bound())
+    {
+        search_state.stopped.store(true);
+    }
+}
+
+void TabuSearch::select_move(SearchState &search_state) const
+{
+    const size_t iteration = ++search_state.nb_iterations;
+    const ScheduleNeighbourhood &current = *search_state.current;
+    const auto is_tabu = [&](uint64_t attribute) {
+        const auto it = search_state.tabu_list.find(attribute);
+        return it != search_state.tabu_list.end() && it->second >= iteration;
+    };
+
+    // the best admissible candidate, drawn uniformly among the ties
+    search_state.selected_move.reset();
+    size_t selected_makespan = std::numeric_limits<size_t>::max();
+    size_t nb_ties = 0;
+    for (const auto &candidates : search_state.worker_candidates)
+    {
+        for (const Candidate &candidate : candidates)
+        {
+            if (candidate.makespan > selected_makespan)
+            {
+                continue;
+            }
+            const bool aspirated = candidate.makespan < search_state.shared_incumbent.get_best_makespan();
+            if (!aspirated && std::ranges::any_of(get_attributes(current, candidate.move, false), is_tabu))
+            {
+                continue;
+            }
+
+            nb_ties = candidate.makespan < selected_makespan ? 1 : nb_ties + 1;
+            if (nb_ties == 1 || search_state.selection_generator.uniform_index(nb_ties) == 0)
+            {
+                search_state.selected_move = candidate.move;
+                selected_makespan = candidate.makespan;
+            }
+        }
+    }
+    if (!search_state.selected_move)
+    {
+        return;
+    }
+
+    for (uint64_t attribute : get_attributes(current, *search_state.selected_move, true))
+    {
+        search_state.tabu_list[attribute] = iteration + Settings::Solver::TABU_SEARCH_TENURE;
+    }
+    if (iteration % Settings::Solver::TABU_SEARCH_TENURE == 0)
+    {
+        std::erase_if(search_state.tabu_list, [iteration](const auto &entry) { return entry.second < iteration; });
+    }
+
+    search_state.current->apply(*search_state.selected_move);
+    search_state.current->set_makespan(selected_makespan);
+    if (selected_makespan < search_state.shared_incumbent.get_best_makespan())
+    {
+        const ScheduleEncoding &encoding = search_state.current->get_encoding();
+        search_state.decoder.redecode(encoding.activity_list, encoding.job_modes);
+        publish(search_state);
+    }
+}
+
+std::vector<uint64_t> TabuSearch::get_attributes(const ScheduleNeighbourhood &neighbourhood, const ScheduleMove &move,
+                                                 bool reverse)
+{
+    // the job in the high half, the mode plus one in the low half or zero for a list move
+    const auto &activity_list = neighbourhood.get_encoding().activity_list;
+    switch (move.type)
+    {
+    case ScheduleMoveType::SHIFT:
+        return {uint64_t{activity_list[move.first]} << 32};
+    case ScheduleMoveType::SWAP:
+        return {uint64_t{activity_list[move.first]} << 32, uint64_t{activity_list[move.second]} << 32};
+    case ScheduleMoveType::MODE_CHANGE:
+        return {(uint64_t{move.first} << 32) | ((reverse ? move.previous_mode : move.second) + 1)};
+    }
+    return {};
+}
+
+void TabuSearch::publish(SearchState &search_state) const
+{
+    // the search state decoder holds the schedule of the current encoding
+    const ScheduleEncoding &encoding = search_state.current->get_encoding();
+    search_state.shared_incumbent.offer(encoding.makespan,
+                                        search_state.decoder.get_job_allocations(encoding.job_modes));
+}
@@ -9,13 +9,17 @@
 #include "Shared/Exceptions.hpp"
 #include "gurobi_c++.h"
 #include "loguru.hpp"
+#include <cmath>
+#include <exception>
 #include <format>
+#include <memory>
 #include <source_location>
+#include <stop_token>
 #include <tuple>
 
-void init_variables(const Solution &init_solution, std::vector<GRBVar> &vars);
+void init_variables(const std::vector<double> &start_values, std::vector<GRBVar> &vars);
 
-std::vector<GRBVar> generate_problem_gurobi(const Solution &init_solution, const ILPSolverModel &ilp_model,
+std::vector<GRBVar> generate_problem_gurobi(const std::vector<double> &start_values, const ILPSolverModel &ilp_model,
                                             GRBModel &grb_model)
 {
     std::vector<GRBVar> vars;
@@ -102,16 +106,111 @@ std::vector<GRBVar> generate_problem_gurobi(const Solution &init_solution, const
         ++cons_index;
     }
 
-    // TODO enable initilization of solution in case
-    if (Settings::Solver::INIT_ILP_SOLUTION)
+    if (!start_values.empty())
     {
-        init_variables(init_solution, vars);
+        init_variables(start_values, vars);
     }
 
     return vars;
 }
 
-std::vector<GRBEnv> threadEnv;
+class SolutionCallback : public GRBCallback
+{
+  public:
+    SolutionCallback(const std::vector<GRBVar> &vars, const LazyConstraintGenerator &lazy_constraint_generator,
+                     const IncumbentCallback &incumbent_callback, std::stop_token stop_token)
+        : vars(vars), lazy_constraint_generator(lazy_constraint_generator), incumbent_callback(incumbent_callback),
+          stop_token(std::move(stop_token))
+    {}
+
+    // exceptions must not cross the Gurobi callback, they are rethrown once optimize returns
+    void rethrow_exception() const
+    {
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+  protected:
+    void callback() override
+    {
+        // the callback is called regularly from every optimization phase, the optimization ends as interrupted
+        if (stop_token.stop_requested())
+        {
+            abort();
+            return;
+        }
+        if (where != GRB_CB_MIPSOL || exception)
+        {
+            return;
+        }
+
+        try
+        {
+            std::unique_ptr<double[]> values(getSolution(vars.data(), static_cast<int>(vars.size())));
+            const std::vector<double> solution(values.get(), values.get() + vars.size());
+
+            std::vector<LazyConstraint> lazy_constraints;
+            if (lazy_constraint_generator)
+            {
+                lazy_constraints = lazy_constraint_generator(solution);
+            }
+
+            // a solution cut off by a lazy constraint is rejected, it does not become an incumbent
+            if (lazy_constraints.empty() && incumbent_callback)
+            {
+                incumbent_callback(solution, getDoubleInfo(GRB_CB_MIPSOL_OBJ), getDoubleInfo(GRB_CB_MIPSOL_OBJBND));
+            }
+
+            for (const auto &lazy_constraint : lazy_constraints)
+            {
+                GRBLinExpr expr;
+                for (const auto &[index, value] : lazy_constraint.row)
+                {
+                    expr += value * vars[index];
+                }
+
+                switch (lazy_constraint.op)
+                {
+                    using enum Operator;
+                case LESS_EQUAL:
+                    addLazy(expr <= lazy_constraint.b);
+                    break;
+                case EQUAL:
+                    addLazy(expr == lazy_constraint.b);
+                    break;
+                case GREATER_EQUAL:
+                    addLazy(expr >= lazy_constraint.b);
+                }
+            }
+        } catch (...)
+        {
+            exception = std::current_exception();
+            abort();
+        }
+    }
+
+  private:
+    const std::vector<GRBVar> &vars;
+    const LazyConstraintGenerator &lazy_constraint_generator;
+    const IncumbentCallback &incumbent_callback;
+    std::stop_token stop_token;
+    std::exception_ptr exception;
+};
+
+// every thread owns one environment for the whole run, the license is checked out once per thread
+static GRBEnv &get_thread_environment()
+{
+    thread_local std::unique_ptr<GRBEnv> env;
+    if (!env)
+    {
+        env = std::make_unique<GRBEnv>(true);
+        env->set(GRB_IntParam_OutputFlag, 0);
+        env->start();
+    }
+    return *env;
+}
 
 std::string GurobiSolver::get_solver_identification() const
 {
@@ -127,62 +226,59 @@ std::string GurobiSolver::get_solver_identification() const
     return identification;
 }
 
-void GurobiSolver::initialize_local_environments(size_t nb_of_threads) const
+// a partial MIP start, Gurobi completes the variables left undefined
+void init_variables(const std::vector<double> &start_values, std::vector<GRBVar> &vars)
 {
-    try
-    {
-        threadEnv.resize(nb_of_threads);
-    } catch (GRBException &e)
+    PPK_ASSERT_ERROR(start_values.size() == vars.size(), "Invalid MIP start: %zu values for %zu variables",
+                     start_values.size(), vars.size());
+
+    for (size_t index = 0; index < vars.size(); ++index)
     {
-        throw CustomException(std::source_location::current(), e.getMessage());
+        if (!std::isnan(start_values[index]))
+        {
+            vars[index].set(GRB_DoubleAttr_Start, start_values[index]);
+        }
     }
 }
 
-void init_variables(const Solution &init_solution, std::vector<GRBVar> &vars)
-{
-    // TODO
-}
-
-SolutionILP GurobiSolver::solve_ilp(Solution &init_solution, const ILPSolverModel &ilp_model, bool verbose, double gap,
-                                    double time_limit, size_t nb_of_threads, size_t thread_id) const
+SolutionILP GurobiSolver::solve_ilp(const std::vector<double> &start_values, const ILPSolverModel &ilp_model,
+                                    bool verbose, double gap, double time_limit, size_t nb_of_threads) const
 {
     SolutionILP solution_ilp;
 
     try
     {
-        PPK_ASSERT_ERROR(thread_id >= 0, "thread_id has negative value");
-
-        PPK_ASSERT_ERROR((threadEnv.size() > static_cast<size_t>(thread_id)),
-                         "Either the Gurobi environments were not initialized or the number of "
-                         "concurrent threads "
-                         "specified incorrectly in the initialize_local_environments method!");
+        // the model works on a copy of the environment, the parameters set here do not leak into the next solve
+        GRBModel grb_model(get_thread_environment());
 
-        threadEnv[thread_id].set(GRB_IntParam_Threads, static_cast<int>(nb_of_threads));
+        grb_model.set(GRB_IntParam_Threads, static_cast<int>(nb_of_threads));
 
         if (time_limit != 0.0)
         {
-            threadEnv[thread_id].set(GRB_DoubleParam_TimeLimit, time_limit);
+            grb_model.set(GRB_DoubleParam_TimeLimit, time_limit);
         }
         if (gap != 0.0)
         {
-            threadEnv[thread_id].set(GRB_DoubleParam_MIPGap, gap);
+            grb_model.set(GRB_DoubleParam_MIPGap, gap);
         }
 
-        if (verbose)
+        grb_model.set(GRB_IntParam_OutputFlag, verbose ? 1 : 0);
+        grb_model.set(GRB_IntParam_LogToConsole, verbose ? 1 : 0);
+
+        const std::vector<GRBVar> &vars = generate_problem_gurobi(start_values, ilp_model, grb_model);
+
+        SolutionCallback solution_callback(vars, lazy_constraint_generator, incumbent_callback, stop_token);
+        if (lazy_constraint_generator)
         {
-            threadEnv[thread_id].set(GRB_IntParam_OutputFlag, 1);
-            threadEnv[thread_id].set(GRB_IntParam_LogToConsole, 1);
-        } else
+            grb_model.set(GRB_IntParam_LazyConstraints, 1);
+        }
+        if (lazy_constraint_generator || incumbent_callback || stop_token.stop_possible())
         {
-            threadEnv[thread_id].set(GRB_IntParam_OutputFlag, 0);
-            threadEnv[thread_id].set(GRB_IntParam_LogToConsole, 0);
+            grb_model.setCallback(&solution_callback);
         }
 
-        GRBModel grb_model(threadEnv[thread_id]);
-
-        const std::vector<GRBVar> &vars = generate_problem_gurobi(init_solution, ilp_model, grb_model);
-
         grb_model.optimize();
+        solution_callback.rethrow_exception();
 
         switch (grb_model.get(GRB_IntAttr_Status))
         {
@@ -197,6 +293,7 @@ SolutionILP GurobiSolver::solve_ilp(Solution &init_solution, const ILPSolverMode
             }
             break;
         case GRB_TIME_LIMIT:
+        case GRB_INTERRUPTED:
             if (grb_model.get(GRB_IntAttr_SolCount) > 0)
             {
                 solution_ilp.status = MODEL_SOL_FEASIBLE;
@@ -0,0 +1,673 @@
+#include "External/ILPSolverModel/ILPSolverModel.hpp"
+#include "External/pempek_assert.hpp"
+#include "Shared/Utils.hpp"
+#include "loguru.hpp"
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <format>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <zlib.h>
+
+namespace
+{
+constexpr size_t WRITE_BUFFER_SIZE = 1 << 16;
+constexpr size_t READ_BUFFER_SIZE = 1 << 16;
+// upper bound on the number of matrix elements transposed at once while writing the COLUMNS section
+constexpr size_t MPS_COLUMN_CHUNK_SIZE = 1 << 22;
+constexpr size_t LP_LINE_LENGTH = 200;
+
+bool is_compressed(const std::string &file_name) { return file_name.ends_with(".gz"); }
+
+class ModelFileWriter
+{
+  public:
+    explicit ModelFileWriter(const std::string &file_name)
+        : file_name(file_name), file(gzopen(file_name.c_str(), is_compressed(file_name) ? "wb" : "wT"))
+    {
+        PPK_ASSERT_ERROR(file != nullptr, "Cannot open %s for writing", file_name.c_str());
+        buffer.reserve(WRITE_BUFFER_SIZE);
+    }
+    ModelFileWriter(const ModelFileWriter &) = delete;
+    ModelFileWriter &operator=(const ModelFileWriter &) = delete;
+
+    ~ModelFileWriter()
+    {
+        if (file != nullptr)
+        {
+            gzclose(file);
+        }
+    }
+
+    void write(std::string_view text)
+    {
+        buffer.append(text);
+        if (buffer.size() >= WRITE_BUFFER_SIZE)
+        {
+            flush();
+        }
+    }
+
+    void close()
+    {
+        flush();
+        int status = gzclose(file);
+        file = nullptr;
+        PPK_ASSERT_ERROR(status == Z_OK, "Error while closing %s", file_name.c_str());
+    }
+
+  private:
+    void flush()
+    {
+        if (!buffer.empty())
+        {
+            int written = gzwrite(file, buffer.data(), static_cast<unsigned>(buffer.size()));
+            PPK_ASSERT_ERROR(written == static_cast<int>(buffer.size()), "Error while writing %s", file_name.c_str());
+            buffer.clear();
+        }
+    }
+
+    std::string file_name;
+    gzFile file;
+    std::string buffer;
+};
+
+class ModelFileReader
+{
+  public:
+    explicit ModelFileReader(const std::string &file_name)
+        : file_name(file_name), file(gzopen(file_name.c_str(), "rb")), buffer(READ_BUFFER_SIZE, '\0')
+    {
+        PPK_ASSERT_ERROR(file != nullptr, "Cannot open %s for reading", file_name.c_str());
+    }
+    ModelFileReader(const ModelFileReader &) = delete;
+    ModelFileReader &operator=(const ModelFileReader &) = delete;
+
+    ~ModelFileReader() { gzclose(file); }
+
+    bool read_line(std::string &line)
+    {
+        line.clear();
+        while (gzgets(file, buffer.data(), static_cast<int>(buffer.size())) != nullptr)
+        {
+            line.append(buffer.data());
+            if (line.ends_with('\n'))
+            {
+                break;
+            }
+        }
+
+        int error_number = Z_OK;
+        gzerror(file, &error_number);
+        PPK_ASSERT_ERROR(error_number == Z_OK || error_number == Z_STREAM_END, "Error while reading %s",
+                         file_name.c_str());
+
+        while (!line.empty() && (line.back() == '\n' || line.back() == '\r'))
+        {
+            line.pop_back();
+        }
+        return !line.empty() || !gzeof(file);
+    }
+
+  private:
+    std::string file_name;
+    gzFile file;
+    std::string buffer;
+};
+
+std::string sanitize_name(std::string_view name)
+{
+    std::string sanitized(name);
+    for (char &c : sanitized)
+    {
+        if (!std::isalnum(static_cast<unsigned char>(c)) &&
+            std::string_view("_#{}.!$%&()/,;?@|~").find(c) == std::string_view::npos)
+        {
+            c = '_';
+        }
+    }
+    return sanitized;
+}
+
+std::vector<std::string> get_column_names(const ILPSolverModel &ilp_model)
+{
+    std::vector<std::string> column_names;
+    column_names.reserve(ilp_model.get_nb_variables());
+    std::unordered_set<std::string_view> unique_names;
+
+    for (size_t j = 0; j < ilp_model.get_nb_variables(); ++j)
+    {
+        column_names.emplace_back(ilp_model.varDesc.empty() ? std::format("x_{}", j)
+                                                            : sanitize_name(ilp_model.varDesc[j]));
+    }
+    for (const auto &name : column_names)
+    {
+        PPK_ASSERT_ERROR(unique_names.emplace(name).second, "Variable name %s is not unique", name.c_str());
+    }
+    return column_names;
+}
+
+// the row index is appended to the description since constraint descriptions are shared by many rows
+std::string get_row_name(const ILPSolverModel &ilp_model, size_t i)
+{
+    return std::format("{}_{}", ilp_model.conDesc.empty() ? "r" : sanitize_name(ilp_model.conDesc[i]), i);
+}
+
+std::string_view get_row_description(std::string_view row_name, size_t i)
+{
+    std::string suffix = std::format("_{}", i);
+    return row_name.ends_with(suffix) ? row_name.substr(0, row_name.size() - suffix.size()) : row_name;
+}
+
+bool is_default_binary(const DecisionVariable &variable)
+{
+    return variable.type == DecisionVariableType::BIN && variable.lower_bound == 0.0 && variable.upper_bound == 1.0;
+}
+
+void split(std::string_view line, std::vector<std::string_view> &tokens)
+{
+    tokens.clear();
+    size_t pos = line.find_first_not_of(" \t");
+    while (pos != std::string_view::npos)
+    {
+        size_t end = line.find_first_of(" \t", pos);
+        tokens.emplace_back(line.substr(pos, end == std::string_view::npos ? std::string_view::npos : end - pos));
+        pos = line.find_first_not_of(" \t", end);
+    }
+}
+
+double parse_number(std::string_view token)
+{
+    double value = 0.0;
+    auto [ptr, error_code] = std::from_chars(token.data(), token.data() + token.size(), value);
+    PPK_ASSERT_ERROR(error_code == std::errc() && ptr == token.data() + token.size(), "Invalid number %.*s",
+                     static_cast<int>(token.size()), token.data());
+    return value;
+}
+
+void write_lp_term(ModelFileWriter &writer, std::string &line, double coefficient, const std::string &name)
+{
+    line += std::format(" {} {} {}", coefficient < 0.0 ? '-' : '+', std::abs(coefficient), name);
+    if (line.size() >= LP_LINE_LENGTH)
+    {
+        line += '\n';
+        writer.write(line);
+        line.clear();
+    }
+}
+} // namespace
+
+void ILPSolverModel::write_mps(const std::string &file_name) const
+{
+    check_ilp_formulation();
+    PPK_ASSERT_ERROR(gurobiC.empty(), "Piecewise objective functions cannot be exported");
+
+    const std::vector<std::string> column_names = get_column_names(*this);
+    const size_t nb_variables = get_nb_variables();
+    ModelFileWriter writer(file_name);
+
+    writer.write(std::format("NAME {}\n", name));
+    if (obj == ObjectiveFunction::MAXIMIZE)
+    {
+        writer.write("OBJSENSE\n    MAX\n");
+    }
+
+    writer.write("ROWS\n N  obj\n");
+    for (size_t i = 0; i < get_nb_constraints(); ++i)
+    {
+        char type = vector_op[i] == Operator::LESS_EQUAL ? 'L' : (vector_op[i] == Operator::EQUAL ? 'E' : 'G');
+        writer.write(std::format(" {}  {}\n", type, get_row_name(*this, i)));
+    }
+
+    // MPS is column-major while matrix_A is row-major, the columns are transposed in chunks to bound the memory
+    std::vector<size_t> nb_column_elements(nb_variables, 0);
+    for (const auto &row : matrix_A)
+    {
+        for (const auto &[j, value] : row)
+        {
+            ++nb_column_elements[j];
+        }
+    }
+
+    writer.write("COLUMNS\n");
+    bool integer_block = false;
+    std::vector<size_t> offsets;
+    std::vector<std::pair<size_t, double>> elements;
+    for (size_t first = 0; first < nb_variables;)
+    {
+        size_t last = first;
+        size_t nb_elements = 0;
+        while (last < nb_variables &&
+               (last == first || nb_elements + nb_column_elements[last] <= MPS_COLUMN_CHUNK_SIZE))
+        {
+            nb_elements += nb_column_elements[last];
+            ++last;
+        }
+
+        offsets.assign(last - first + 1, 0);
+        for (size_t j = first; j < last; ++j)
+        {
+            offsets[j - first + 1] = offsets[j - first] + nb_column_elements[j];
+        }
+        elements.resize(nb_elements);
+        std::vector<size_t> positions(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < get_nb_constraints(); ++i)
+        {
+            for (const auto &[j, value] : matrix_A[i])
+            {
+                if (j >= first && j < last)
+                {
+                    elements[positions[j - first]++] = {i, value};
+                }
+            }
+        }
+
+        for (size_t j = first; j < last; ++j)
+        {
+            bool is_integer = vector_x[j].type != DecisionVariableType::FLT;
+            if (is_integer != integer_block)
+            {
+                writer.write(is_integer ? "    MARKER  'MARKER'  'INTORG'\n" : "    MARKER  'MARKER'  'INTEND'\n");
+                integer_block = is_integer;
+            }
+
+            // every column is written at least once so that the reader knows about it
+            if (vector_c[j] != 0.0 || nb_column_elements[j] == 0)
+            {
+                writer.write(std::format("    {}  obj  {}\n", column_names[j], vector_c[j]));
+            }
+            for (size_t k = offsets[j - first]; k < offsets[j - first + 1]; ++k)
+            {
+                writer.write(std::format("    {}  {}  {}\n", column_names[j], get_row_name(*this, elements[k].first),
+                                         elements[k].second));
+            }
+        }
+        first = last;
+    }
+    if (integer_block)
+    {
+        writer.write("    MARKER  'MARKER'  'INTEND'\n");
+    }
+
+    writer.write("RHS\n");
+    for (size_t i = 0; i < get_nb_constraints(); ++i)
+    {
+        if (vector_b[i] != 0.0)
+        {
+            writer.write(std::format("    RHS  {}  {}\n", get_row_name(*this, i), vector_b[i]));
+        }
+    }
+
+    writer.write("BOUNDS\n");
+    for (size_t j = 0; j < nb_variables; ++j)
+    {
+        const DecisionVariable &variable = vector_x[j];
+        const std::string &name = column_names[j];
+        if (is_default_binary(variable))
+        {
+            writer.write(std::format(" BV BND  {}\n", name));
+        } else if (variable.lower_bound == variable.upper_bound)
+        {
+            writer.write(std::format(" FX BND  {}  {}\n", name, variable.lower_bound));
+        } else if (variable.lower_bound == F64_MIN && variable.upper_bound == F64_MAX)
+        {
+            writer.write(std::format(" FR BND  {}\n", name));
+        } else
+        {
+            if (variable.lower_bound == F64_MIN)
+            {
+                writer.write(std::format(" MI BND  {}\n", name));
+            } else if (variable.lower_bound != 0.0)
+            {
+                writer.write(std::format(" LO BND  {}  {}\n", name, variable.lower_bound));
+            }
+
+            if (variable.upper_bound != F64_MAX)
+            {
+                writer.write(std::format(" UP BND  {}  {}\n", name, variable.upper_bound));
+            } else if (variable.type != DecisionVariableType::FLT)
+            {
+                writer.write(std::format(" PL BND  {}\n", name));
+            }
+        }
+    }
+    writer.write("ENDATA\n");
+    writer.close();
+
+    LOG_F(INFO, "ILP model written to %s", file_name.c_str());
+}
+
+void ILPSolverModel::write_lp(const std::string &file_name) const
+{
+    check_ilp_formulation();
+    PPK_ASSERT_ERROR(gurobiC.empty(), "Piecewise objective functions cannot be exported");
+
+    const std::vector<std::string> column_names = get_column_names(*this);
+    const size_t nb_variables = get_nb_variables();
+    ModelFileWriter writer(file_name);
+    std::string line;
+
+    writer.write(obj == ObjectiveFunction::MAXIMIZE ? "Maximize\n" : "Minimize\n");
+    line = " obj:";
+    bool empty_objective = true;
+    for (size_t j = 0; j < nb_variables; ++j)
+    {
+        if (vector_c[j] != 0.0)
+        {
+            write_lp_term(writer, line, vector_c[j], column_names[j]);
+            empty_objective = false;
+        }
+    }
+    if (empty_objective)
+    {
+        line += std::format(" 0 {}", column_names[0]);
+    }
+    line += '\n';
+    writer.write(line);
+
+    writer.write("Subject To\n");
+    for (size_t i = 0; i < get_nb_constraints(); ++i)
+    {
+        line = std::format(" {}:", get_row_name(*this, i));
+        for (const auto &[j, value] : matrix_A[i])
+        {
+            write_lp_term(writer, line, value, column_names[j]);
+        }
+        const char *op = vector_op[i] == Operator::LESS_EQUAL ? "<=" : (vector_op[i] == Operator::EQUAL ? "=" : ">=");
+        line += std::format(" {} {}\n", op, vector_b[i]);
+        writer.write(line);
+    }
+
+    writer.write("Bounds\n");
+    for (size_t j = 0; j < nb_variables; ++j)
+    {
+        const DecisionVariable &variable = vector_x[j];
+        if (is_default_binary(variable) || (variable.lower_bound == 0.0 && variable.upper_bound == F64_MAX))
+        {
+            continue;
+        }
+
+        if (variable.lower_bound == variable.upper_bound)
+        {
+            writer.write(std::format(" {} = {}\n", column_names[j], variable.lower_bound));
+        } else if (variable.lower_bound == F64_MIN && variable.upper_bound == F64_MAX)
+        {
+            writer.write(std::format(" {} free\n", column_names[j]));
+        } else
+        {
+            std::string lower_bound =
+                variable.lower_bound == F64_MIN ? "-inf" : std::format("{}", variable.lower_bound);
+            std::string upper_bound =
+                variable.upper_bound == F64_MAX ? "+inf" : std::format("{}", variable.upper_bound);
+            writer.write(std::format(" {} <= {} <= {}\n", lower_bound, column_names[j], upper_bound));
+        }
+    }
+
+    writer.write("Generals\n");
+    for (size_t j = 0; j < nb_variables; ++j)
+    {
+        if (vector_x[j].type != DecisionVariableType::FLT && !is_default_binary(vector_x[j]))
+        {
+            writer.write(std::format(" {}\n", column_names[j]));
+        }
+    }
+
+    writer.write("Binaries\n");
+    for (size_t j = 0; j < nb_variables; ++j)
+    {
+        if (is_default_binary(vector_x[j]))
+        {
+            writer.write(std::format(" {}\n", column_names[j]));
+        }
+    }
+    writer.write("End\n");
+    writer.close();
+
+    LOG_F(INFO, "ILP model written to %s", file_name.c_str());
+}
+
+void ILPSolverModel::read_mps(const std::string &file_name)
+{
+    PPK_ASSERT_ERROR(get_nb_variables() == 0 && get_nb_constraints() == 0, "The ILP model must be empty");
+
+    constexpr size_t OBJECTIVE_ROW = std::numeric_limits<size_t>::max();
+    constexpr size_t FREE_ROW = OBJECTIVE_ROW - 1;
+
+    enum class Section
+    {
+        NONE,
+        OBJSENSE,
+        ROWS,
+        COLUMNS,
+        RHS,
+        BOUNDS
+    };
+
+    ModelFileReader reader(file_name);
+    Section section = Section::NONE;
+    std::string line;
+    std::vector<std::string_view> tokens;
+    std::string objective_name;
+    std::vector<std::string> row_names;
+    std::unordered_map<std::string, size_t, StringHash, std::equal_to<>> row_indices;
+    std::unordered_map<std::string, size_t, StringHash, std::equal_to<>> column_indices;
+    std::vector<SparseMatrix<double>::Row> rows;
+    std::vector<bool> integer_columns;
+    bool integer_block = false;
+    bool end_of_data = false;
+
+    auto get_row_index = [&](std::string_view name) {
+        auto it = row_indices.find(name);
+        PPK_ASSERT_ERROR(it != row_indices.end(), "Unknown row %.*s", static_cast<int>(name.size()), name.data());
+        return it->second;
+    };
+
+    auto get_column_index = [&](std::string_view name) {
+        auto it = column_indices.find(name);
+        PPK_ASSERT_ERROR(it != column_indices.end(), "Unknown column %.*s", static_cast<int>(name.size()),
+                         name.data());
+        return it->second;
+    };
+
+    while (!end_of_data && reader.read_line(line))
+    {
+        split(line, tokens);
+        if (tokens.empty() || line.front() == '*')
+        {
+            continue;
+        }
+
+        if (line.front() != ' ' && line.front() != '\t')
+        {
+            if (tokens[0] == "NAME")
+            {
+                section = Section::NONE;
+                name = tokens.size() > 1 ? std::string(tokens[1]) : std::string();
+            } else if (tokens[0] == "OBJSENSE")
+            {
+                section = Section::OBJSENSE;
+                if (tokens.size() > 1)
+                {
+                    obj = tokens[1] == "MAX" || tokens[1] == "MAXIMIZE" ? ObjectiveFunction::MAXIMIZE
+                                                                         : ObjectiveFunction::MINIMIZE;
+                }
+            } else if (tokens[0] == "ROWS")
+            {
+                section = Section::ROWS;
+            } else if (tokens[0] == "COLUMNS")
+            {
+                section = Section::COLUMNS;
+            } else if (tokens[0] == "RHS")
+            {
+                section = Section::RHS;
+            } else if (tokens[0] == "BOUNDS")
+            {
+                section = Section::BOUNDS;
+            } else if (tokens[0] == "ENDATA")
+            {
+                end_of_data = true;
+            } else
+            {
+                PPK_ASSERT_ERROR(false, "Unsupported MPS section %s in %s", line.c_str(), file_name.c_str());
+            }
+            continue;
+        }
+
+        switch (section)
+        {
+            using enum Section;
+        case OBJSENSE:
+            obj = tokens[0] == "MAX" || tokens[0] == "MAXIMIZE" ? ObjectiveFunction::MAXIMIZE
+                                                                : ObjectiveFunction::MINIMIZE;
+            break;
+        case ROWS: {
+            PPK_ASSERT_ERROR(tokens.size() == 2, "Invalid MPS row %s", line.c_str());
+            std::string name(tokens[1]);
+            if (tokens[0] == "N")
+            {
+                row_indices.emplace(name, objective_name.empty() ? OBJECTIVE_ROW : FREE_ROW);
+                if (objective_name.empty())
+                {
+                    objective_name = name;
+                }
+                break;
+            }
+
+            PPK_ASSERT_ERROR(tokens[0] == "L" || tokens[0] == "E" || tokens[0] == "G", "Invalid MPS row type %s",
+                             line.c_str());
+            vector_op.emplace_back(tokens[0] == "L" ? Operator::LESS_EQUAL
+                                                    : (tokens[0] == "E" ? Operator::EQUAL : Operator::GREATER_EQUAL));
+            PPK_ASSERT_ERROR(row_indices.emplace(name, rows.size()).second, "Row %s is not unique", name.c_str());
+            row_names.emplace_back(std::move(name));
+            rows.emplace_back();
+            break;
+        }
+        case COLUMNS: {
+            if (tokens.size() >= 3 && tokens[1] == "'MARKER'")
+            {
+                integer_block = tokens[2] == "'INTORG'";
+                break;
+            }
+
+            PPK_ASSERT_ERROR(tokens.size() == 3 || tokens.size() == 5, "Invalid MPS column %s", line.c_str());
+            if (varDesc.empty() || varDesc.back() != tokens[0])
+            {
+                PPK_ASSERT_ERROR(column_indices.emplace(std::string(tokens[0]), varDesc.size()).second,
+                                 "Column %s is not contiguous", line.c_str());
+                varDesc.emplace_back(tokens[0]);
+                vector_c.emplace_back(0.0);
+                integer_columns.push_back(integer_block);
+            }
+
+            const size_t column = varDesc.size() - 1;
+            for (size_t k = 1; k + 1 < tokens.size(); k += 2)
+            {
+                size_t row = get_row_index(tokens[k]);
+                double value = parse_number(tokens[k + 1]);
+                if (row == OBJECTIVE_ROW)
+                {
+                    vector_c[column] = value;
+                } else if (row != FREE_ROW)
+                {
+                    rows[row].emplace_back(column, value);
+                }
+            }
+            break;
+        }
+        case RHS: {
+            if (vector_b.empty())
+            {
+                vector_b.resize(rows.size(), 0.0);
+            }
+            // the name of the right-hand side vector is optional
+            for (size_t k = tokens.size() % 2; k + 1 < tokens.size(); k += 2)
+            {
+                size_t row = get_row_index(tokens[k]);
+                if (row < rows.size())
+                {
+                    vector_b[row] = parse_number(tokens[k + 1]);
+                }
+            }
+            break;
+        }
+        case BOUNDS: {
+            if (vector_x.empty())
+            {
+                vector_x.resize(varDesc.size(), DecisionVariable(DecisionVariableType::FLT, 0.0, F64_MAX));
+            }
+
+            std::string_view type = tokens[0];
+            bool has_value = type == "UP" || type == "LO" || type == "FX" || type == "LI" || type == "UI";
+            PPK_ASSERT_ERROR(tokens.size() >= (has_value ? 3 : 2), "Invalid MPS bound %s", line.c_str());
+            const size_t name_position = (tokens.size() == (has_value ? 4 : 3)) ? 2 : 1;
+            DecisionVariable &variable = vector_x[get_column_index(tokens[name_position])];
+            const double value = has_value ? parse_number(tokens[name_position + 1]) : 0.0;
+
+            if (type == "UP" || type == "UI")
+            {
+                variable.upper_bound = value;
+                if (value < 0.0 && variable.lower_bound == 0.0)
+                {
+                    variable.lower_bound = F64_MIN;
+                }
+            } else if (type == "LO" || type == "LI")
+            {
+                variable.lower_bound = value;
+            } else if (type == "FX")
+            {
+                variable.lower_bound = variable.upper_bound = value;
+            } else if (type == "FR")
+            {
+                variable.lower_bound = F64_MIN;
+                variable.upper_bound = F64_MAX;
+            } else if (type == "MI")
+            {
+                variable.lower_bound = F64_MIN;
+            } else if (type == "PL")
+            {
+                variable.upper_bound = F64_MAX;
+            } else if (type == "BV")
+            {
+                variable.lower_bound = 0.0;
+                variable.upper_bound = 1.0;
+                variable.type = DecisionVariableType::BIN;
+            } else
+            {
+                PPK_ASSERT_ERROR(false, "Unsupported MPS bound type %s", line.c_str());
+            }
+
+            if (type == "LI" || type == "UI")
+            {
+                integer_columns[get_column_index(tokens[name_position])] = true;
+            }
+            break;
+        }
+        case NONE:
+            PPK_ASSERT_ERROR(false, "Unexpected MPS line %s", line.c_str());
+            break;
+        }
+    }
+    PPK_ASSERT_ERROR(end_of_data, "Missing ENDATA in %s", file_name.c_str());
+
+    vector_b.resize(rows.size(), 0.0);
+    vector_x.resize(varDesc.size(), DecisionVariable(DecisionVariableType::FLT, 0.0, F64_MAX));
+    for (size_t j = 0; j < vector_x.size(); ++j)
+    {
+        if (integer_columns[j] && vector_x[j].type != DecisionVariableType::BIN)
+        {
+            vector_x[j].type = DecisionVariableType::INT;
+        }
+    }
+
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        PPK_ASSERT_ERROR(!rows[i].empty(), "Row %s is empty", row_names[i].c_str());
+        matrix_A.add_row(std::move(rows[i]));
+        conDesc.emplace_back(get_row_description(row_names[i], i));
+    }
+
+    check_ilp_formulation();
+    LOG_F(INFO, "ILP model read from %s", file_name.c_str());
+}
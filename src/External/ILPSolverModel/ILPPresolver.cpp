@@ -0,0 +1,411 @@
+#include "External/ILPSolverModel/ILPPresolver.hpp"
+#include "External/pempek_assert.hpp"
+#include "loguru.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    constexpr double EPSILON = 1e-9;
+    constexpr double INFINITE_BOUND = 1e20;
+
+    bool is_integral(const DecisionVariable &variable) { return variable.type != DecisionVariableType::FLT; }
+
+    bool is_binary(const DecisionVariable &variable)
+    {
+        return is_integral(variable) && variable.lower_bound > -EPSILON && variable.upper_bound < 1.0 + EPSILON;
+    }
+
+    bool is_finite(double bound) { return std::abs(bound) < INFINITE_BOUND; }
+} // namespace
+
+void ILPPresolver::fix_variable(size_t index, double value) { requested_fixings.emplace_back(index, value); }
+
+void ILPPresolver::presolve(ILPSolverModel &ilp_model)
+{
+    ilp_model.check_ilp_formulation();
+
+    nb_original_variables = ilp_model.get_nb_variables();
+    nb_original_constraints = ilp_model.get_nb_constraints();
+    fixed.assign(nb_original_variables, false);
+    fixed_values.assign(nb_original_variables, 0.0);
+    removed_rows.assign(nb_original_constraints, false);
+    nb_tightened_coefficients = 0;
+
+    for (const auto &[index, value] : requested_fixings)
+    {
+        PPK_ASSERT_ERROR(index < nb_original_variables, "Invalid variable index %ld", index);
+        DecisionVariable &variable = ilp_model.vector_x[index];
+        PPK_ASSERT_ERROR(value >= variable.lower_bound - EPSILON && value <= variable.upper_bound + EPSILON,
+                         "Fixed value %f of variable %ld is out of bounds", value, index);
+        variable.lower_bound = value;
+        variable.upper_bound = value;
+    }
+    requested_fixings.clear();
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = fix_equal_bounds(ilp_model);
+        changed = substitute_fixed_variables(ilp_model) || changed;
+        changed = apply_singleton_rows(ilp_model) || changed;
+    }
+
+    tighten_coefficients(ilp_model);
+    fix_empty_columns(ilp_model);
+    remove_fixed_columns(ilp_model);
+
+    ilp_model.check_ilp_formulation();
+}
+
+std::vector<double> ILPPresolver::postsolve(const std::vector<double> &reduced_solution) const
+{
+    if (!is_active())
+    {
+        return reduced_solution;
+    }
+
+    PPK_ASSERT_ERROR(reduced_solution.size() == original_index.size(), "Invalid size of the reduced solution");
+
+    std::vector<double> solution(nb_original_variables);
+    for (size_t index = 0; index < nb_original_variables; ++index)
+    {
+        size_t reduced = reduced_index[index];
+        solution[index] = (reduced == REMOVED) ? fixed_values[index] : reduced_solution[reduced];
+    }
+    return solution;
+}
+
+size_t ILPPresolver::get_reduced_index(size_t index) const
+{
+    if (!is_active())
+    {
+        return index;
+    }
+    PPK_ASSERT_ERROR(index < nb_original_variables, "Invalid variable index %ld", index);
+    return reduced_index[index];
+}
+
+void ILPPresolver::reduce_row(SparseMatrix<double>::Row &row, double &b) const
+{
+    if (!is_active())
+    {
+        return;
+    }
+
+    SparseMatrix<double>::Row reduced_row;
+    reduced_row.reserve(row.size());
+    for (const auto &[index, value] : row)
+    {
+        size_t reduced = get_reduced_index(index);
+        if (reduced == REMOVED)
+        {
+            b -= value * fixed_values[index];
+        } else
+        {
+            reduced_row.emplace_back(reduced, value);
+        }
+    }
+    row = std::move(reduced_row);
+}
+
+double ILPPresolver::get_fixed_value(size_t index) const
+{
+    PPK_ASSERT_ERROR(is_active() && index < nb_original_variables && reduced_index[index] == REMOVED,
+                     "Variable %ld was not removed by the presolve", index);
+    return fixed_values[index];
+}
+
+bool ILPPresolver::is_active() const { return nb_original_variables > 0; }
+
+void ILPPresolver::log_statistics() const
+{
+    LOG_F(INFO, "Presolve removed %ld of %ld variables", nb_original_variables - original_index.size(),
+          nb_original_variables);
+    LOG_F(INFO, "Presolve removed %ld of %ld constraints",
+          static_cast<size_t>(std::ranges::count(removed_rows, true)), nb_original_constraints);
+    LOG_F(INFO, "Presolve tightened %ld coefficients", nb_tightened_coefficients);
+}
+
+bool ILPPresolver::fix_equal_bounds(ILPSolverModel &ilp_model)
+{
+    bool changed = false;
+    for (size_t index = 0; index < nb_original_variables; ++index)
+    {
+        const DecisionVariable &variable = ilp_model.vector_x[index];
+        if (!fixed[index] && std::abs(variable.upper_bound - variable.lower_bound) < EPSILON)
+        {
+            fixed[index] = true;
+            fixed_values[index] = variable.lower_bound;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+bool ILPPresolver::substitute_fixed_variables(ILPSolverModel &ilp_model)
+{
+    bool changed = false;
+    for (size_t row_index = 0; row_index < nb_original_constraints; ++row_index)
+    {
+        if (removed_rows[row_index])
+        {
+            continue;
+        }
+
+        auto &row = ilp_model.matrix_A[row_index];
+        const size_t nb_elements = row.size();
+        std::erase_if(row, [this, &ilp_model, row_index](const auto &element) {
+            if (!is_removable(ilp_model, element.first))
+            {
+                return false;
+            }
+            ilp_model.vector_b[row_index] -= element.second * fixed_values[element.first];
+            return true;
+        });
+        changed = changed || (row.size() != nb_elements);
+
+        if (row.empty())
+        {
+            const double b = ilp_model.vector_b[row_index];
+            switch (ilp_model.vector_op[row_index])
+            {
+                using enum Operator;
+            case LESS_EQUAL:
+                PPK_ASSERT_ERROR(b > -EPSILON, "Presolve detected an infeasible constraint %ld", row_index);
+                break;
+            case EQUAL:
+                PPK_ASSERT_ERROR(std::abs(b) < EPSILON, "Presolve detected an infeasible constraint %ld", row_index);
+                break;
+            case GREATER_EQUAL:
+                PPK_ASSERT_ERROR(b < EPSILON, "Presolve detected an infeasible constraint %ld", row_index);
+            }
+            removed_rows[row_index] = true;
+        }
+    }
+    return changed;
+}
+
+bool ILPPresolver::apply_singleton_rows(ILPSolverModel &ilp_model)
+{
+    bool changed = false;
+    for (size_t row_index = 0; row_index < nb_original_constraints; ++row_index)
+    {
+        const auto &row = ilp_model.matrix_A[row_index];
+        if (removed_rows[row_index] || row.size() != 1)
+        {
+            continue;
+        }
+
+        const auto &[index, coefficient] = row.front();
+        if (std::abs(coefficient) < EPSILON)
+        {
+            continue;
+        }
+
+        Operator op = ilp_model.vector_op[row_index];
+        if (coefficient < 0.0 && op != Operator::EQUAL)
+        {
+            op = (op == Operator::LESS_EQUAL) ? Operator::GREATER_EQUAL : Operator::LESS_EQUAL;
+        }
+
+        changed = tighten_bound(ilp_model.vector_x[index], op, ilp_model.vector_b[row_index] / coefficient) || changed;
+        removed_rows[row_index] = true;
+    }
+    return changed;
+}
+
+void ILPPresolver::tighten_coefficients(ILPSolverModel &ilp_model)
+{
+    for (size_t row_index = 0; row_index < nb_original_constraints; ++row_index)
+    {
+        if (removed_rows[row_index] || ilp_model.vector_op[row_index] != Operator::LESS_EQUAL)
+        {
+            continue;
+        }
+
+        auto &row = ilp_model.matrix_A[row_index];
+        double &b = ilp_model.vector_b[row_index];
+
+        double max_activity = 0.0;
+        bool bounded = true;
+        for (const auto &[index, coefficient] : row)
+        {
+            const DecisionVariable &variable = ilp_model.vector_x[index];
+            double bound = (coefficient > 0.0) ? variable.upper_bound : variable.lower_bound;
+            bounded = bounded && is_finite(bound);
+            max_activity += coefficient * bound;
+        }
+
+        if (!bounded)
+        {
+            continue;
+        }
+
+        if (max_activity <= b + EPSILON)
+        {
+            removed_rows[row_index] = true;
+            continue;
+        }
+
+        for (auto &[index, coefficient] : row)
+        {
+            if (!is_binary(ilp_model.vector_x[index]))
+            {
+                continue;
+            }
+
+            if (coefficient > 0.0 && max_activity - coefficient < b - EPSILON)
+            {
+                double delta = b - (max_activity - coefficient);
+                coefficient -= delta;
+                b -= delta;
+                max_activity -= delta;
+                ++nb_tightened_coefficients;
+            } else if (coefficient < 0.0 && max_activity + coefficient < b - EPSILON)
+            {
+                coefficient += b - (max_activity + coefficient);
+                ++nb_tightened_coefficients;
+            }
+        }
+    }
+}
+
+void ILPPresolver::fix_empty_columns(ILPSolverModel &ilp_model)
+{
+    std::vector<bool> referenced(nb_original_variables, false);
+    for (size_t row_index = 0; row_index < nb_original_constraints; ++row_index)
+    {
+        if (removed_rows[row_index])
+        {
+            continue;
+        }
+        for (const auto &[index, coefficient] : ilp_model.matrix_A[row_index])
+        {
+            referenced[index] = true;
+        }
+    }
+
+    for (size_t index = 0; index < nb_original_variables; ++index)
+    {
+        if (referenced[index] || fixed[index] || ilp_model.vector_c[index] != 0.0)
+        {
+            continue;
+        }
+
+        const DecisionVariable &variable = ilp_model.vector_x[index];
+        fixed[index] = true;
+        fixed_values[index] = is_finite(variable.lower_bound)   ? variable.lower_bound
+                              : is_finite(variable.upper_bound) ? variable.upper_bound
+                                                                : 0.0;
+    }
+}
+
+void ILPPresolver::remove_fixed_columns(ILPSolverModel &ilp_model)
+{
+    reduced_index.assign(nb_original_variables, REMOVED);
+    original_index.clear();
+
+    for (size_t index = 0; index < nb_original_variables; ++index)
+    {
+        if (!is_removable(ilp_model, index))
+        {
+            reduced_index[index] = original_index.size();
+            original_index.emplace_back(index);
+        }
+    }
+
+    std::vector<SparseMatrix<double>::Row> rows;
+    rows.reserve(nb_original_constraints);
+    for (auto &row : ilp_model.matrix_A)
+    {
+        rows.emplace_back(std::move(row));
+    }
+    ilp_model.matrix_A.clear();
+
+    size_t nb_kept_rows = 0;
+    for (size_t row_index = 0; row_index < nb_original_constraints; ++row_index)
+    {
+        if (removed_rows[row_index])
+        {
+            continue;
+        }
+
+        SparseMatrix<double>::Row &row = rows[row_index];
+        for (auto &element : row)
+        {
+            PPK_ASSERT_ERROR(reduced_index[element.first] != REMOVED, "Removed variable %ld is still referenced",
+                             element.first);
+            element.first = reduced_index[element.first];
+        }
+        ilp_model.matrix_A.add_row(std::move(row));
+
+        ilp_model.vector_b[nb_kept_rows] = ilp_model.vector_b[row_index];
+        ilp_model.vector_op[nb_kept_rows] = ilp_model.vector_op[row_index];
+        if (!ilp_model.conDesc.empty())
+        {
+            ilp_model.conDesc[nb_kept_rows] = std::move(ilp_model.conDesc[row_index]);
+        }
+        ++nb_kept_rows;
+    }
+    ilp_model.vector_b.resize(nb_kept_rows);
+    ilp_model.vector_op.resize(nb_kept_rows);
+    if (!ilp_model.conDesc.empty())
+    {
+        ilp_model.conDesc.resize(nb_kept_rows);
+    }
+
+    for (size_t reduced = 0; reduced < original_index.size(); ++reduced)
+    {
+        size_t index = original_index[reduced];
+        ilp_model.vector_x[reduced] = ilp_model.vector_x[index];
+        ilp_model.vector_c[reduced] = ilp_model.vector_c[index];
+        if (!ilp_model.varDesc.empty())
+        {
+            ilp_model.varDesc[reduced] = std::move(ilp_model.varDesc[index]);
+        }
+        if (!ilp_model.gurobiC.empty())
+        {
+            ilp_model.gurobiC[reduced] = ilp_model.gurobiC[index];
+        }
+    }
+    ilp_model.vector_x.resize(original_index.size());
+    ilp_model.vector_c.resize(original_index.size());
+    if (!ilp_model.varDesc.empty())
+    {
+        ilp_model.varDesc.resize(original_index.size());
+    }
+    if (!ilp_model.gurobiC.empty())
+    {
+        ilp_model.gurobiC.resize(original_index.size());
+    }
+}
+
+bool ILPPresolver::is_removable(const ILPSolverModel &ilp_model, size_t index) const
+{
+    return fixed[index] && ilp_model.vector_c[index] == 0.0 &&
+           (ilp_model.gurobiC.empty() || ilp_model.gurobiC[index] == nullptr);
+}
+
+bool ILPPresolver::tighten_bound(DecisionVariable &variable, Operator op, double bound) const
+{
+    double lower_bound = variable.lower_bound;
+    double upper_bound = variable.upper_bound;
+
+    if (op != Operator::GREATER_EQUAL)
+    {
+        upper_bound = std::min(upper_bound, is_integral(variable) ? std::floor(bound + EPSILON) : bound);
+    }
+    if (op != Operator::LESS_EQUAL)
+    {
+        lower_bound = std::max(lower_bound, is_integral(variable) ? std::ceil(bound - EPSILON) : bound);
+    }
+
+    PPK_ASSERT_ERROR(lower_bound <= upper_bound + EPSILON, "Presolve detected infeasible bounds [%f, %f]",
+                     lower_bound, upper_bound);
+
+    bool changed = (lower_bound > variable.lower_bound + EPSILON) || (upper_bound < variable.upper_bound - EPSILON);
+    variable.lower_bound = lower_bound;
+    variable.upper_bound = upper_bound;
+    return changed;
+}
@@ -4,6 +4,8 @@
 #include "Settings.hpp"
 #include "Shared/Utils.hpp"
 #include "loguru.hpp"
+#include <cmath>
+#include <numeric>
 #include <queue>
 #include <rapidjson/document.h>
 #include <rapidjson/prettywriter.h>
@@ -84,20 +86,20 @@ void InstanceGenerator::generated_data_to_json_file()
     LOG_F(INFO, "JSON file written successfully");
 }
 
-InstanceGenerator::ResourceUnits InstanceGenerator::generate_resource_units() const
+InstanceGenerator::ResourceUnits InstanceGenerator::generate_resource_units()
 {
     std::vector<size_t> resource_units(Settings::Generator::NB_RESOURCES);
 
     for (size_t i = 0; i < Settings::Generator::NB_RESOURCES; ++i)
     {
-        resource_units[i] =
-            random_range(Settings::Generator::MIN_RESOURCE_CAPACITY, Settings::Generator::MAX_RESOURCE_CAPACITY);
+        resource_units[i] = generator.uniform_int(Settings::Generator::MIN_RESOURCE_CAPACITY,
+                                                  Settings::Generator::MAX_RESOURCE_CAPACITY);
     }
 
     return resource_units;
 }
 
-InstanceGenerator::Dependencies InstanceGenerator::generate_dependencies() const
+InstanceGenerator::Dependencies InstanceGenerator::generate_dependencies()
 {
     InstanceGenerator::Dependencies dependencies;
     size_t nb_nodes = Settings::Generator::NB_JOBS;
@@ -117,7 +119,7 @@ InstanceGenerator::Dependencies InstanceGenerator::generate_dependencies() const
         q.pop();
 
         size_t nb_child_nodes =
-            random_range(Settings::Generator::MIN_NB_SUCCESSORS, Settings::Generator::MAX_NB_SUCCESSORS);
+            generator.uniform_int(Settings::Generator::MIN_NB_SUCCESSORS, Settings::Generator::MAX_NB_SUCCESSORS);
 
         nb_child_nodes = std::min(nb_child_nodes, nb_nodes - nb_created_nodes);
 
@@ -133,7 +135,7 @@ InstanceGenerator::Dependencies InstanceGenerator::generate_dependencies() const
 }
 
 InstanceGenerator::ProcessingTimes
-InstanceGenerator::generate_processing_times(const InstanceGenerator::JobModes &job_modes) const
+InstanceGenerator::generate_processing_times(const InstanceGenerator::JobModes &job_modes)
 {
     LOG_F(INFO, "job modes size = %ld", job_modes.size());
     InstanceGenerator::ProcessingTimes processing_times(job_modes.size());
@@ -143,7 +145,7 @@ InstanceGenerator::generate_processing_times(const InstanceGenerator::JobModes &
                            [](const std::vector<size_t> &row) { return std::accumulate(row.begin(), row.end(), 0); });
 
     size_t optimal_execution_time_value =
-        random_range(Settings::Generator::MIN_EXECUTION_TIME, Settings::Generator::MAX_EXECUTION_TIME / 2);
+        generator.uniform_int(Settings::Generator::MIN_EXECUTION_TIME, Settings::Generator::MAX_EXECUTION_TIME / 2);
 
     auto max_nb_nodes = std::ranges::max_element(resources_per_mode);
 
@@ -162,9 +164,9 @@ InstanceGenerator::generate_processing_times(const InstanceGenerator::JobModes &
 }
 
 InstanceGenerator::JobModes
-InstanceGenerator::generate_job_modes(const InstanceGenerator::ResourceUnits &resource_units) const
+InstanceGenerator::generate_job_modes(const InstanceGenerator::ResourceUnits &resource_units)
 {
-    std::size_t nb_modes = random_range(Settings::Generator::MIN_NB_MODES, Settings::Generator::MAX_NB_MODES);
+    std::size_t nb_modes = generator.uniform_int(Settings::Generator::MIN_NB_MODES, Settings::Generator::MAX_NB_MODES);
 
     const size_t nb_resources = Settings::Generator::NB_RESOURCES;
 
@@ -179,7 +181,7 @@ InstanceGenerator::generate_job_modes(const InstanceGenerator::ResourceUnits &re
             size_t max_nb_units = std::min(resource_units[j], Settings::Generator::MAX_NB_RESOURCE_UNITS_PER_JOB);
             PPK_ASSERT_ERROR(max_nb_units >= Settings::Generator::MIN_NB_RESOURCE_UNITS_PER_JOB,
                              "Invalid Config Parameter");
-            mode[j] = random_range(Settings::Generator::MIN_NB_RESOURCE_UNITS_PER_JOB, max_nb_units);
+            mode[j] = generator.uniform_int(Settings::Generator::MIN_NB_RESOURCE_UNITS_PER_JOB, max_nb_units);
         }
 
         if (const bool no_resource_units_requested = std::ranges::all_of(mode, [](size_t value) { return value == 0; }))
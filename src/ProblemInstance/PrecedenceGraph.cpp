@@ -0,0 +1,189 @@
+#include "ProblemInstance/PrecedenceGraph.hpp"
+#include "External/pempek_assert.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <queue>
+
+PrecedenceGraph::PrecedenceGraph(const ProblemInstance &problem_instance)
+{
+    const size_t nb_jobs = problem_instance.job_queue.nb_elements();
+    jobs.reserve(nb_jobs);
+    job_indices.reserve(nb_jobs);
+    min_processing_times.reserve(nb_jobs);
+    release_times.reserve(nb_jobs);
+
+    for (const JobConstPtr &job : problem_instance.job_queue)
+    {
+        PPK_ASSERT_ERROR(!job->modes.empty(), "job %s has no modes", job->id.c_str());
+        const auto &[iterator, emplaced] = job_indices.try_emplace(job->id, jobs.size());
+        PPK_ASSERT_ERROR(emplaced, "job %s is duplicated", job->id.c_str());
+        jobs.emplace_back(job);
+        min_processing_times.emplace_back(
+            std::ranges::min(job->modes, std::ranges::less{}, &Mode::processing_time).processing_time);
+        release_times.emplace_back(job->release_time);
+    }
+
+    successors.resize(nb_jobs);
+    predecessors.resize(nb_jobs);
+
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        for (const auto &succ : jobs[job_index]->successors)
+        {
+            size_t succ_index = get_job_index(succ);
+            successors[job_index].emplace_back(succ_index);
+            predecessors[succ_index].emplace_back(job_index);
+        }
+    }
+
+    compute_topological_order();
+}
+
+size_t PrecedenceGraph::get_nb_jobs() const { return jobs.size(); }
+
+size_t PrecedenceGraph::get_job_index(const std::string &job_id) const
+{
+    auto it = job_indices.find(job_id);
+    PPK_ASSERT_ERROR(it != job_indices.end(), "job %s was not found", job_id.c_str());
+    return it->second;
+}
+
+const JobConstPtr &PrecedenceGraph::get_job(size_t job_index) const { return jobs.at(job_index); }
+
+const std::vector<size_t> &PrecedenceGraph::get_successors(size_t job_index) const
+{
+    return successors.at(job_index);
+}
+
+const std::vector<size_t> &PrecedenceGraph::get_predecessors(size_t job_index) const
+{
+    return predecessors.at(job_index);
+}
+
+const std::vector<size_t> &PrecedenceGraph::get_topological_order() const { return topological_order; }
+
+size_t PrecedenceGraph::get_min_processing_time(size_t job_index) const { return min_processing_times.at(job_index); }
+
+size_t PrecedenceGraph::get_release_time(size_t job_index) const { return release_times.at(job_index); }
+
+std::vector<size_t> PrecedenceGraph::compute_heads() const { return compute_heads(release_times); }
+
+std::vector<size_t> PrecedenceGraph::compute_heads(const std::vector<size_t> &job_release_times) const
+{
+    PPK_ASSERT_ERROR(job_release_times.size() == jobs.size(), "one release time per job is expected");
+    std::vector<size_t> heads(jobs.size(), 0);
+
+    for (size_t job_index : topological_order)
+    {
+        heads[job_index] = std::max(heads[job_index], job_release_times[job_index]);
+        for (size_t succ_index : successors[job_index])
+        {
+            heads[succ_index] = std::max(heads[succ_index], heads[job_index] + min_processing_times[job_index]);
+        }
+    }
+    return heads;
+}
+
+std::vector<size_t> PrecedenceGraph::compute_tails() const
+{
+    std::vector<size_t> tails(jobs.size(), 0);
+
+    for (auto it = topological_order.rbegin(); it != topological_order.rend(); ++it)
+    {
+        size_t longest_successor_tail = 0;
+        for (size_t succ_index : successors[*it])
+        {
+            longest_successor_tail = std::max(longest_successor_tail, tails[succ_index]);
+        }
+        tails[*it] = min_processing_times[*it] + longest_successor_tail;
+    }
+    return tails;
+}
+
+size_t PrecedenceGraph::compute_critical_path_length() const { return compute_critical_path_length(release_times); }
+
+size_t PrecedenceGraph::compute_critical_path_length(const std::vector<size_t> &job_release_times) const
+{
+    const std::vector<size_t> heads = compute_heads(job_release_times);
+    const std::vector<size_t> tails = compute_tails();
+
+    size_t critical_path_length = 0;
+    for (size_t job_index = 0; job_index < jobs.size(); ++job_index)
+    {
+        critical_path_length = std::max(critical_path_length, heads[job_index] + tails[job_index]);
+    }
+    return critical_path_length;
+}
+
+std::vector<std::vector<size_t>> PrecedenceGraph::compute_transitive_reduction() const
+{
+    const size_t nb_jobs = jobs.size();
+    const size_t nb_words = (nb_jobs + 63) / 64;
+
+    std::vector<size_t> topological_position(nb_jobs);
+    for (size_t position = 0; position < nb_jobs; ++position)
+    {
+        topological_position[topological_order[position]] = position;
+    }
+
+    // reachable[j] is the bitset of the jobs reachable from j, filled in reverse topological order
+    std::vector<std::vector<uint64_t>> reachable(nb_jobs, std::vector<uint64_t>(nb_words, 0));
+    std::vector<std::vector<size_t>> reduced_successors(nb_jobs);
+
+    for (auto it = topological_order.rbegin(); it != topological_order.rend(); ++it)
+    {
+        std::vector<size_t> sorted_successors = successors[*it];
+        std::ranges::sort(sorted_successors, std::ranges::less{},
+                          [&topological_position](size_t job_index) { return topological_position[job_index]; });
+
+        // an arc is implied when its head is reachable through a successor placed earlier in the order
+        std::vector<uint64_t> &reachable_jobs = reachable[*it];
+        for (size_t succ_index : sorted_successors)
+        {
+            if (reachable_jobs[succ_index / 64] & (uint64_t{1} << (succ_index % 64)))
+            {
+                continue;
+            }
+            reduced_successors[*it].emplace_back(succ_index);
+            reachable_jobs[succ_index / 64] |= uint64_t{1} << (succ_index % 64);
+            for (size_t word = 0; word < nb_words; ++word)
+            {
+                reachable_jobs[word] |= reachable[succ_index][word];
+            }
+        }
+    }
+    return reduced_successors;
+}
+
+void PrecedenceGraph::compute_topological_order()
+{
+    std::vector<size_t> nb_unvisited_predecessors(jobs.size());
+    std::queue<size_t> ready_jobs;
+
+    for (size_t job_index = 0; job_index < jobs.size(); ++job_index)
+    {
+        nb_unvisited_predecessors[job_index] = predecessors[job_index].size();
+        if (nb_unvisited_predecessors[job_index] == 0)
+        {
+            ready_jobs.emplace(job_index);
+        }
+    }
+
+    topological_order.reserve(jobs.size());
+    while (!ready_jobs.empty())
+    {
+        size_t job_index = ready_jobs.front();
+        ready_jobs.pop();
+        topological_order.emplace_back(job_index);
+
+        for (size_t succ_index : successors[job_index])
+        {
+            if (--nb_unvisited_predecessors[succ_index] == 0)
+            {
+                ready_jobs.emplace(succ_index);
+            }
+        }
+    }
+
+    PPK_ASSERT_ERROR(topological_order.size() == jobs.size(), "Invalid dependencies: the precedence graph has a cycle");
+}
@@ -3,6 +3,7 @@
 #include "Shared/Utils.hpp"
 #include "loguru.hpp"
 #include <queue>
+#include <ranges>
 #include <unordered_set>
 
 ProblemInstance::ProblemInstance(const std::string &name) : name(name) {}
@@ -15,6 +16,80 @@ void ProblemInstance::set_makespan_upperbound()
         makespan_upper_bound += max_value.processing_time;
     });
 }
+
+size_t ProblemInstance::compute_energy_lower_bound() const
+{
+    size_t energy_lower_bound = 0;
+    for (size_t resource_index = 0; resource_index < resources.size(); ++resource_index)
+    {
+        if (resources[resource_index].units == 0)
+        {
+            continue;
+        }
+
+        size_t energy = 0;
+        for (const JobConstPtr &job : job_queue)
+        {
+            auto mode_energy = [resource_index](const Mode &mode) {
+                return mode.processing_time * mode.requested_resources.at(resource_index).units;
+            };
+            energy += std::ranges::min(job->modes | std::views::transform(mode_energy));
+        }
+
+        const size_t capacity = resources[resource_index].units;
+        energy_lower_bound = std::max(energy_lower_bound, (energy + capacity - 1) / capacity);
+    }
+    return energy_lower_bound;
+}
+
+uint64_t ProblemInstance::compute_fingerprint() const
+{
+    // FNV-1a over the fields in job order, a string is preceded by its length so that fields cannot run together
+    uint64_t fingerprint = 0xcbf29ce484222325;
+    auto add_bytes = [&fingerprint](const void *data, size_t size) {
+        for (size_t i = 0; i < size; ++i)
+        {
+            fingerprint = (fingerprint ^ static_cast<const unsigned char *>(data)[i]) * 0x100000001b3;
+        }
+    };
+    auto add_value = [&add_bytes](uint64_t value) { add_bytes(&value, sizeof(value)); };
+    auto add_string = [&add_bytes, &add_value](const std::string &value) {
+        add_value(value.size());
+        add_bytes(value.data(), value.size());
+    };
+
+    add_value(makespan_upper_bound);
+    add_value(resources.size());
+    for (const auto &resource : resources)
+    {
+        add_string(resource.id);
+        add_value(resource.units);
+    }
+    add_value(job_queue.nb_elements());
+    for (const JobConstPtr &job : job_queue)
+    {
+        add_string(job->id);
+        add_value(job->release_time);
+        add_value(job->modes.size());
+        for (const auto &mode : job->modes)
+        {
+            add_value(mode.processing_time);
+            add_value(mode.requested_resources.size());
+            for (const auto &requested_resource : mode.requested_resources)
+            {
+                add_string(requested_resource.id);
+                add_value(requested_resource.units);
+            }
+        }
+        add_value(job->successors.size());
+        for (const auto &successor : job->successors)
+        {
+            add_string(successor);
+        }
+    }
+    return fingerprint;
+}
+
 const std::vector<Resource> &ProblemInstance::get_resources() const { return this->resources; }
 const std::string &ProblemInstance::get_name() const { return this->name; }
 
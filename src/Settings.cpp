@@ -10,6 +10,7 @@ namespace Settings
     size_t FIRST_INSTANCE_INDEX = DEFAULT_FIRST_INSTANCE_INDEX;
     size_t LAST_INSTANCE_INDEX = DEFAULT_LAST_INSTANCE_INDEX;
     std::string INSTANCE_NAME = DEFAULT_INSTANCE_NAME;
+    size_t RANDOM_SEED = DEFAULT_RANDOM_SEED;
 
     namespace Generator
     {
@@ -37,11 +38,58 @@ namespace Settings
         bool USE_CPLEX = DEFAULT_USE_CPLEX;
         bool USE_CP = DEFAULT_USE_CP;
         bool CHECK_SOLUTION = DEFAULT_CHECK_SOLUTION;
+        bool JUSTIFY_SCHEDULE = DEFAULT_JUSTIFY_SCHEDULE;
         bool DRAW_GANTT_CHART = DEFAULT_DRAW_GANTT_CHART;
+        bool WRITE_CONVERGENCE = DEFAULT_WRITE_CONVERGENCE;
 
         /* ILP SOLVER OPTIONS */
         bool INIT_ILP_SOLUTION = DEFAULT_INIT_ILP_SOLUTION;
         double ILP_RELATIVE_GAP = DEFAULT_ILP_RELATIVE_GAP;
+        bool ILP_PRESOLVE = DEFAULT_ILP_PRESOLVE;
+        std::string ILP_FORMULATION = DEFAULT_ILP_FORMULATION;
+        std::string ILP_MODEL_CACHE_DIRECTORY = DEFAULT_ILP_MODEL_CACHE_DIRECTORY;
+        bool ILP_LAZY_RESOURCE_CONSTRAINTS = DEFAULT_ILP_LAZY_RESOURCE_CONSTRAINTS;
+
+        size_t CP_WORKERS = DEFAULT_CP_WORKERS;
+        std::string CP_SEARCH_TYPE = DEFAULT_CP_SEARCH_TYPE;
+        bool CP_DETERMINISTIC_PARALLEL = DEFAULT_CP_DETERMINISTIC_PARALLEL;
+        bool CP_REDUNDANT_CUMULATIVE = DEFAULT_CP_REDUNDANT_CUMULATIVE;
+        bool CP_MAKESPAN_LOWER_BOUND = DEFAULT_CP_MAKESPAN_LOWER_BOUND;
+        bool CP_TRANSITIVE_REDUCTION = DEFAULT_CP_TRANSITIVE_REDUCTION;
+        bool CP_UNARY_NO_OVERLAP = DEFAULT_CP_UNARY_NO_OVERLAP;
+        std::string CP_SEARCH_PHASE = DEFAULT_CP_SEARCH_PHASE;
+        std::string CP_MODE_PREFERENCE = DEFAULT_CP_MODE_PREFERENCE;
         bool INIT_SOLUTION = DEFAULT_INIT_SOLUTION;
+
+        bool USE_LNS = DEFAULT_USE_LNS;
+        size_t LNS_WORKERS = DEFAULT_LNS_WORKERS;
+        size_t LNS_NEIGHBOURHOOD_SIZE = DEFAULT_LNS_NEIGHBOURHOOD_SIZE;
+        double LNS_ITERATION_TIME_LIMIT = DEFAULT_LNS_ITERATION_TIME_LIMIT;
+
+        bool USE_BRANCH_AND_BOUND = DEFAULT_USE_BRANCH_AND_BOUND;
+        size_t BRANCH_AND_BOUND_WORKERS = DEFAULT_BRANCH_AND_BOUND_WORKERS;
+        size_t BRANCH_AND_BOUND_CUTSET_LIMIT = DEFAULT_BRANCH_AND_BOUND_CUTSET_LIMIT;
+
+        bool USE_PRIORITY_RULES = DEFAULT_USE_PRIORITY_RULES;
+        size_t PRIORITY_RULE_PASSES = DEFAULT_PRIORITY_RULE_PASSES;
+
+        bool USE_GENETIC_ALGORITHM = DEFAULT_USE_GENETIC_ALGORITHM;
+        size_t GA_ISLANDS = DEFAULT_GA_ISLANDS;
+        size_t GA_POPULATION_SIZE = DEFAULT_GA_POPULATION_SIZE;
+        double GA_MUTATION_PROBABILITY = DEFAULT_GA_MUTATION_PROBABILITY;
+        size_t GA_MIGRATION_INTERVAL = DEFAULT_GA_MIGRATION_INTERVAL;
+
+        bool USE_SIMULATED_ANNEALING = DEFAULT_USE_SIMULATED_ANNEALING;
+        size_t SA_REPLICAS = DEFAULT_SA_REPLICAS;
+        double SA_INITIAL_TEMPERATURE = DEFAULT_SA_INITIAL_TEMPERATURE;
+        double SA_FINAL_TEMPERATURE = DEFAULT_SA_FINAL_TEMPERATURE;
+        size_t SA_ROUND_MOVES = DEFAULT_SA_ROUND_MOVES;
+
+        bool USE_TABU_SEARCH = DEFAULT_USE_TABU_SEARCH;
+        size_t TABU_SEARCH_WORKERS = DEFAULT_TABU_SEARCH_WORKERS;
+        size_t TABU_SEARCH_CANDIDATES = DEFAULT_TABU_SEARCH_CANDIDATES;
+        size_t TABU_SEARCH_TENURE = DEFAULT_TABU_SEARCH_TENURE;
+        bool USE_PORTFOLIO = DEFAULT_USE_PORTFOLIO;
+        std::string PORTFOLIO_BACKENDS = DEFAULT_PORTFOLIO_BACKENDS;
     } // namespace Solver
 } // namespace Settings
@@ -0,0 +1,41 @@
+#include "Shared/Random.hpp"
+#include "Settings.hpp"
+#include <algorithm>
+#include <random>
+
+RandomGenerator::RandomGenerator(uint64_t seed, uint64_t stream)
+{
+    // consecutive splitmix64 outputs, never all zero
+    uint64_t value = seed ^ mix_seed(stream);
+    for (auto &word : state)
+    {
+        value += 0x9e3779b97f4a7c15;
+        word = mix_seed(value);
+    }
+}
+
+size_t RandomGenerator::weighted_index(const std::vector<double> &cumulative_weights)
+{
+    PPK_ASSERT_ERROR(!cumulative_weights.empty() && cumulative_weights.back() > 0.0, "Cannot draw without a weight");
+    const double draw = uniform_real() * cumulative_weights.back();
+    const size_t index = std::ranges::upper_bound(cumulative_weights, draw) - cumulative_weights.begin();
+    // the product may round up to the total weight
+    return std::min(index, cumulative_weights.size() - 1);
+}
+
+uint64_t mix_seed(uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+    return value ^ (value >> 31);
+}
+
+uint64_t make_seed(uint64_t index)
+{
+    if (Settings::RANDOM_SEED == 0)
+    {
+        std::random_device device;
+        return (static_cast<uint64_t>(device()) << 32) | device();
+    }
+    return mix_seed(Settings::RANDOM_SEED ^ mix_seed(index));
+}
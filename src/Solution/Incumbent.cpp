@@ -0,0 +1,171 @@
+#include "Solution/Incumbent.hpp"
+#include "External/pempek_assert.hpp"
+#include "loguru.hpp"
+#include <fstream>
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+IncumbentPublisher::IncumbentPublisher(std::vector<IncumbentListener> listeners)
+    : listeners(std::move(listeners)), start_time(std::chrono::steady_clock::now())
+{}
+
+bool IncumbentPublisher::has_listeners() const { return !listeners.empty(); }
+
+bool IncumbentPublisher::improves(size_t makespan) const { return has_listeners() && makespan < best_makespan; }
+
+void IncumbentPublisher::publish(size_t makespan, double bound, const std::vector<JobAllocation> &job_allocations)
+{
+    if (!improves(makespan))
+    {
+        return;
+    }
+    best_makespan = makespan;
+
+    Incumbent incumbent;
+    incumbent.timestamp = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    incumbent.makespan = makespan;
+    incumbent.bound = bound;
+    incumbent.job_allocations = job_allocations;
+
+    for (const auto &listener : listeners)
+    {
+        listener(incumbent);
+    }
+}
+
+IncumbentStore::IncumbentStore() : start_time(std::chrono::steady_clock::now()) {}
+
+IncumbentListener IncumbentStore::get_listener()
+{
+    return [this](const Incumbent &incumbent) { offer(incumbent); };
+}
+
+bool IncumbentStore::offer(const Incumbent &incumbent)
+{
+    // cheap rejection of the incumbents found by the other solvers in the meantime
+    if (incumbent.makespan >= best_makespan.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    std::scoped_lock lock(mutex);
+    if (best.has_value() && incumbent.makespan >= best->makespan)
+    {
+        return false;
+    }
+    best = incumbent;
+    best->timestamp = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    convergence.emplace_back(best->timestamp, best->makespan, best->bound);
+    best_makespan.store(incumbent.makespan, std::memory_order_relaxed);
+    return true;
+}
+
+std::optional<Incumbent> IncumbentStore::get_best() const
+{
+    std::scoped_lock lock(mutex);
+    return best;
+}
+
+size_t IncumbentStore::get_best_makespan() const { return best_makespan.load(std::memory_order_relaxed); }
+
+std::vector<ConvergencePoint> IncumbentStore::get_convergence() const
+{
+    std::scoped_lock lock(mutex);
+    return convergence;
+}
+
+SharedIncumbent::SharedIncumbent(std::vector<IncumbentListener> listeners, size_t makespan_lower_bound)
+    : makespan_lower_bound(makespan_lower_bound), publisher(std::move(listeners))
+{}
+
+size_t SharedIncumbent::get_best_makespan() const { return best_makespan.load(std::memory_order_relaxed); }
+
+bool SharedIncumbent::reached_lower_bound() const { return get_best_makespan() == makespan_lower_bound; }
+
+void SharedIncumbent::offer(size_t makespan, std::vector<JobAllocation> job_allocations)
+{
+    replace(makespan, std::move(job_allocations), true);
+}
+
+std::optional<Incumbent> SharedIncumbent::get_import(const IncumbentStore *incumbent_source) const
+{
+    if (incumbent_source == nullptr || incumbent_source->get_best_makespan() >= get_best_makespan())
+    {
+        return std::nullopt;
+    }
+    return incumbent_source->get_best();
+}
+
+void SharedIncumbent::offer_import(size_t makespan, size_t imported_makespan,
+                                   std::vector<JobAllocation> job_allocations)
+{
+    replace(makespan, std::move(job_allocations), makespan < imported_makespan);
+}
+
+void SharedIncumbent::complete_solution(Solution &solution)
+{
+    std::scoped_lock lock(mutex);
+    if (best_job_allocations.empty())
+    {
+        solution.solution_state = SolutionState::UNKNOWN;
+        return;
+    }
+
+    const size_t makespan = best_makespan.load();
+    solution.solution_state = makespan == makespan_lower_bound ? SolutionState::OPTIMAL : SolutionState::FEASIBLE;
+    solution.makespan = makespan;
+    solution.objective_bound = static_cast<double>(makespan_lower_bound);
+    // an instance without any processing time has an empty schedule
+    solution.gap =
+        makespan > 0 ? static_cast<double>(makespan - makespan_lower_bound) / static_cast<double>(makespan) : 0.0;
+    solution.job_allocations = std::move(best_job_allocations);
+}
+
+void SharedIncumbent::replace(size_t makespan, std::vector<JobAllocation> job_allocations, bool published)
+{
+    std::scoped_lock lock(mutex);
+    if (makespan >= best_makespan.load())
+    {
+        return;
+    }
+    best_makespan.store(makespan);
+    if (published)
+    {
+        publisher.publish(makespan, static_cast<double>(makespan_lower_bound), job_allocations);
+    }
+    best_job_allocations = std::move(job_allocations);
+}
+
+IncumbentListener make_incumbent_logger(const std::string &solver_name)
+{
+    return [solver_name](const Incumbent &incumbent) {
+        LOG_F(INFO, "%s incumbent: makespan = %zu, bound = %f, time = %f s", solver_name.c_str(), incumbent.makespan,
+              incumbent.bound, incumbent.timestamp);
+    };
+}
+
+void write_convergence_to_json(const std::vector<ConvergencePoint> &convergence, const std::string &file_name)
+{
+    rapidjson::Document doc(rapidjson::kObjectType);
+    auto &allocator = doc.GetAllocator();
+
+    rapidjson::Value points(rapidjson::kArrayType);
+    for (const auto &[timestamp, makespan, bound] : convergence)
+    {
+        rapidjson::Value point(rapidjson::kObjectType);
+        point.AddMember("time", timestamp, allocator);
+        point.AddMember("makespan", static_cast<uint64_t>(makespan), allocator);
+        point.AddMember("bound", bound, allocator);
+        points.PushBack(point, allocator);
+    }
+    doc.AddMember("incumbents", points, allocator);
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    doc.Accept(writer);
+    std::ofstream ofs(file_name);
+    PPK_ASSERT_ERROR(ofs.is_open(), "Failed to open the file %s", file_name.c_str());
+    ofs << buffer.GetString() << std::endl;
+    ofs.close();
+}
@@ -100,7 +100,8 @@ std::string Solution::get_solution_as_string() const
                   << "Run Time: " << this->runtime << ", "
                   << "Gap: " << this->gap << ", "
                   << "Makespan: " << this->makespan << ", "
-                  << "State: " << solution_state_as_string(this->solution_state) << "\n";
+                  << "State: " << solution_state_as_string(this->solution_state) << ", "
+                  << "Configuration: " << this->solver_configuration << "\n";
 
     std::string job_allocations_string;
     for (const auto &job_allocation : job_allocations)
@@ -221,8 +222,8 @@ void write_solution(const std::string &instance_solution_file, const std::string
 
 void write_statistics(const std::string &statistics_file, const std::string &instance_id, const Solution &solution)
 {
-    static const std::vector<std::string> statistics_file_header = {"Instance_ID", "Run_Time", "Gap", "Makespan",
-                                                                    "Status"};
+    static const std::vector<std::string> statistics_file_header = {"Instance_ID", "Run_Time", "Gap",
+                                                                    "Makespan",    "Status",   "Solver_Configuration"};
     static const std::string sheet_name = "statistics";
 
     static ResultWriter statistics_writer(statistics_file, statistics_file_header);
@@ -231,7 +232,8 @@ void write_statistics(const std::string &statistics_file, const std::string &ins
                                                       {"Run_Time", std::to_string(solution.runtime)},
                                                       {"Gap", std::to_string(solution.gap)},
                                                       {"Makespan", std::to_string(solution.makespan)},
-                                                      {"Status", solution_state_as_string(solution.solution_state)}}};
+                                                      {"Status", solution_state_as_string(solution.solution_state)},
+                                                      {"Solver_Configuration", solution.solver_configuration}}};
 
     if (!statistics_writer.sheet_exists(sheet_name))
     {
@@ -105,13 +105,41 @@ bool SolutionChecker::check_resource_usage_over_time_period() const
                      "at least one job is not allocated %ld, %ld", this->solution.job_allocations.size(),
                      this->problem_instance.job_queue.nb_elements());
 
-    std::vector<JobAllocation> allocations = sort_by_field(this->solution.job_allocations, &JobAllocation::start_time);
+    // difference array of the usages: an allocation adds its demands at its start time and takes them back at its
+    // finish time, the unsigned changes wrap around but their running sums are the exact usages
+    const size_t nb_resources = this->problem_instance.resources.size();
+    size_t horizon = 0;
+    for (const auto &allocation : this->solution.job_allocations)
+    {
+        horizon = std::max(horizon, allocation.start_time + allocation.duration);
+    }
+    std::vector<size_t> usage_changes((horizon + 1) * nb_resources, 0);
+    for (const auto &allocation : this->solution.job_allocations)
+    {
+        const auto &job = this->problem_instance.job_queue.get_element(allocation.job_id);
+        PPK_ASSERT_ERROR(job != nullptr, "Job was not found");
+        PPK_ASSERT_ERROR(allocation.mode_id > 0, "Invalid value %ld", allocation.mode_id);
+        size_t mode_index = allocation.mode_id - 1;
+        PPK_ASSERT_ERROR(mode_index < job->modes.size(), "Invalid value %ld", mode_index);
+        const size_t finish_time = allocation.start_time + allocation.duration;
+        for (size_t i = 0; i < nb_resources; ++i)
+        {
+            const size_t units = job->modes.at(mode_index).requested_resources.at(i).units;
+            usage_changes[allocation.start_time * nb_resources + i] += units;
+            usage_changes[finish_time * nb_resources + i] -= units;
+        }
+    }
 
-    for (size_t time = 0; time < this->solution.makespan; ++time)
+    std::vector<size_t> usage(nb_resources, 0);
+    for (size_t time = 0; time < horizon; ++time)
     {
-        if (!check_resource_usage_at_given_time(allocations, time))
+        for (size_t i = 0; i < nb_resources; ++i)
         {
-            return false;
+            usage[i] += usage_changes[time * nb_resources + i];
+            if (usage[i] > this->problem_instance.resources.at(i).units)
+            {
+                return false;
+            }
         }
     }
     return true;
@@ -0,0 +1,45 @@
+#include "SolverBackends.hpp"
+#include "External/pempek_assert.hpp"
+
+std::map<std::string, SolverBackend, std::less<>> &SolverBackendRegistry::get_backends()
+{
+    static std::map<std::string, SolverBackend, std::less<>> backends;
+    return backends;
+}
+
+void SolverBackendRegistry::register_backend(SolverBackend backend)
+{
+    PPK_ASSERT_ERROR(!is_available(backend.name), "Solver backend %s registered twice", backend.name.c_str());
+    std::string name = backend.name;
+    get_backends().emplace(std::move(name), std::move(backend));
+}
+
+bool SolverBackendRegistry::is_available(std::string_view name) { return get_backends().contains(name); }
+
+const SolverBackend &SolverBackendRegistry::get_backend(std::string_view name)
+{
+    auto it = get_backends().find(name);
+    PPK_ASSERT_ERROR(it != get_backends().end(), "Solver backend %.*s is not available in this build",
+                     static_cast<int>(name.size()), name.data());
+    return it->second;
+}
+
+std::vector<std::string> SolverBackendRegistry::get_available_backend_names()
+{
+    std::vector<std::string> names;
+    for (const auto &[name, backend] : get_backends())
+    {
+        names.emplace_back(name);
+    }
+    return names;
+}
+
+std::string SolverBackendRegistry::get_available_backends_as_string()
+{
+    std::string names;
+    for (const auto &[name, backend] : get_backends())
+    {
+        names += names.empty() ? name : ", " + name;
+    }
+    return names.empty() ? "none" : names;
+}
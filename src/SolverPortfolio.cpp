@@ -0,0 +1,191 @@
+#include "SolverPortfolio.hpp"
+#include "Algorithms/ScheduleGeneration/PriorityRuleHeuristic.hpp"
+#include "External/pempek_assert.hpp"
+#include "ProblemInstance/PrecedenceGraph.hpp"
+#include "Shared/Random.hpp"
+#include "loguru.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <format>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <thread>
+
+static constexpr std::string_view portfolio_backend_name = "portfolio";
+
+SolverPortfolio::RaceState::RaceState(double lower_bound) : lower_bound(lower_bound) {}
+
+SolverPortfolio::SolverPortfolio(const ProblemInstance &problem_instance, std::vector<std::string> backend_names)
+    : problem_instance(problem_instance), backend_names(std::move(backend_names))
+{
+    PPK_ASSERT_ERROR(!this->backend_names.empty(), "The portfolio needs at least one backend");
+    const PrecedenceGraph precedence_graph(problem_instance);
+    makespan_lower_bound =
+        std::max(precedence_graph.compute_critical_path_length(), problem_instance.compute_energy_lower_bound());
+}
+
+std::vector<std::string> SolverPortfolio::parse_backend_names(std::string_view backend_names)
+{
+    std::vector<std::string> names;
+    for (const auto &token : std::views::split(backend_names, ','))
+    {
+        std::string_view name(token.begin(), token.end());
+        const size_t first = name.find_first_not_of(' ');
+        if (first == std::string_view::npos)
+        {
+            continue;
+        }
+        name = name.substr(first, name.find_last_not_of(' ') - first + 1);
+        PPK_ASSERT_ERROR(name != portfolio_backend_name, "The portfolio cannot race itself");
+        PPK_ASSERT_ERROR(SolverBackendRegistry::is_available(name),
+                         "The %.*s backend is not available in this build (available: %s)",
+                         static_cast<int>(name.size()), name.data(),
+                         SolverBackendRegistry::get_available_backends_as_string().c_str());
+        if (std::ranges::find(names, name) == names.end())
+        {
+            names.emplace_back(name);
+        }
+    }
+
+    if (names.empty())
+    {
+        std::ranges::copy_if(SolverBackendRegistry::get_available_backend_names(), std::back_inserter(names),
+                             [](const std::string &name) { return name != portfolio_backend_name; });
+    }
+    return names;
+}
+
+Solution SolverPortfolio::solve(const SolverContext &context) const
+{
+    const auto start = std::chrono::steady_clock::now();
+    RaceState race_state(static_cast<double>(makespan_lower_bound));
+    std::stop_callback forward_stop(context.stop_token, [&race_state] { race_state.stop_source.request_stop(); });
+
+    // the deterministic priority rule passes give a first incumbent, which the CP and ILP backends start from
+    {
+        PriorityRuleHeuristic heuristic(problem_instance);
+        heuristic.set_nb_passes(PriorityRuleHeuristic::get_priority_rules().size());
+        heuristic.set_seed(context.seed);
+        heuristic.add_incumbent_listener(make_incumbent_logger("PriorityRules"));
+        heuristic.add_incumbent_listener(context.incumbent_store.get_listener());
+        const Solution seed = heuristic.solve();
+        if (seed.solution_state == SolutionState::OPTIMAL || seed.solution_state == SolutionState::FEASIBLE)
+        {
+            update(race_state, "priority_rules", seed.makespan, seed.objective_bound);
+        }
+    }
+
+    {
+        // the members search with unrelated seeds, drawn in the order of the backend names
+        RandomGenerator member_seeds(context.seed);
+        std::vector<std::jthread> members;
+        for (const auto &backend_name : backend_names)
+        {
+            if (race_state.stop_source.stop_requested())
+            {
+                break;
+            }
+            members.emplace_back([this, &backend_name, seed = member_seeds(), &context, &race_state] {
+                try
+                {
+                    run_member(backend_name, seed, context, race_state);
+                } catch (...)
+                {
+                    std::scoped_lock lock(race_state.mutex);
+                    if (!race_state.member_exception)
+                    {
+                        race_state.member_exception = std::current_exception();
+                    }
+                    race_state.stop_source.request_stop();
+                }
+            });
+        }
+    }
+
+    // the first failure of a backend is reported once all the backends stopped
+    if (race_state.member_exception)
+    {
+        std::rethrow_exception(race_state.member_exception);
+    }
+
+    std::string joined_backend_names;
+    for (const auto &backend_name : backend_names)
+    {
+        joined_backend_names += joined_backend_names.empty() ? backend_name : "," + backend_name;
+    }
+
+    Solution solution;
+    solution.solver_configuration =
+        std::format("Portfolio backends={} leader={}", joined_backend_names, race_state.leader);
+    solution.runtime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const std::optional<Incumbent> best = context.incumbent_store.get_best();
+    if (!best.has_value())
+    {
+        solution.solution_state = SolutionState::UNKNOWN;
+        return solution;
+    }
+
+    solution.makespan = best->makespan;
+    solution.objective_bound = std::min(race_state.lower_bound, static_cast<double>(best->makespan));
+    solution.solution_state = static_cast<double>(best->makespan) <= std::ceil(race_state.lower_bound - 1e-6)
+                                  ? SolutionState::OPTIMAL
+                                  : SolutionState::FEASIBLE;
+    solution.gap =
+        (static_cast<double>(best->makespan) - solution.objective_bound) / static_cast<double>(best->makespan);
+    solution.job_allocations = best->job_allocations;
+    LOG_F(INFO, "portfolio: makespan = %zu found by %s, bound = %f, runtime = %f s", solution.makespan,
+          race_state.leader.c_str(), solution.objective_bound, solution.runtime);
+    return solution;
+}
+
+void SolverPortfolio::run_member(const std::string &backend_name, uint64_t seed, const SolverContext &context,
+                                 RaceState &race_state) const
+{
+    SolverContext member_context{context.incumbent_store, race_state.stop_source.get_token(),
+                                 context.incumbent_listeners, seed};
+    member_context.incumbent_listeners.emplace_back([this, &backend_name, &race_state](const Incumbent &incumbent) {
+        update(race_state, backend_name, incumbent.makespan, incumbent.bound);
+    });
+
+    const Solution solution =
+        SolverBackendRegistry::get_backend(backend_name).solve(problem_instance, member_context);
+    LOG_F(INFO, "portfolio: %s stopped with %s", backend_name.c_str(),
+          solution_state_as_string(solution.solution_state).c_str());
+    if (solution.solution_state != SolutionState::OPTIMAL && solution.solution_state != SolutionState::FEASIBLE)
+    {
+        return;
+    }
+
+    // the final solution of a backend is not always published, and its final bound may raise the lower bound
+    Incumbent incumbent;
+    incumbent.makespan = solution.makespan;
+    incumbent.bound = solution.objective_bound;
+    incumbent.job_allocations = solution.job_allocations;
+    context.incumbent_store.offer(incumbent);
+
+    // a proven optimum closes the gap
+    update(race_state, backend_name, solution.makespan,
+           solution.solution_state == SolutionState::OPTIMAL ? static_cast<double>(solution.makespan)
+                                                             : solution.objective_bound);
+}
+
+void SolverPortfolio::update(RaceState &race_state, const std::string &backend_name, size_t makespan,
+                             double bound) const
+{
+    std::scoped_lock lock(race_state.mutex);
+    race_state.lower_bound = std::max(race_state.lower_bound, bound);
+    if (makespan < race_state.best_makespan)
+    {
+        race_state.best_makespan = makespan;
+        race_state.leader = backend_name;
+    }
+
+    // the makespan is integral, a fractional bound of the ILP is rounded up
+    if (static_cast<double>(race_state.best_makespan) <= std::ceil(race_state.lower_bound - 1e-6))
+    {
+        race_state.stop_source.request_stop();
+    }
+}
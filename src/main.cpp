@@ -1,26 +1,53 @@
+#ifdef MRCPSP_HAS_CPLEX
 #include "Algorithms/CPSolver/CPSolver.hpp"
+#include "Algorithms/LargeNeighbourhoodSearch/LargeNeighbourhoodSearch.hpp"
+#endif
+#include "Algorithms/BranchAndBound/BranchAndBound.hpp"
 #include "Algorithms/ILPOptimizationModel/ProblemSolverILP.hpp"
+#include "Algorithms/GeneticAlgorithm/GeneticAlgorithm.hpp"
+#include "Algorithms/ScheduleGeneration/PriorityRuleHeuristic.hpp"
+#include "Algorithms/ScheduleGeneration/ScheduleJustification.hpp"
+#include "Algorithms/SimulatedAnnealing/SimulatedAnnealing.hpp"
+#include "Algorithms/TabuSearch/TabuSearch.hpp"
 #include "External/ILPSolverModel/ILPSolverInterface.hpp"
 #include "External/cxxopts.hpp"
 #include "InstanceGenerator/InstanceGenerator.hpp"
 #include "InstanceReader/InstanceReader.hpp"
 #include "ProblemInstance/ProblemInstance.hpp"
 #include "Settings.hpp"
+#include "Shared/Random.hpp"
 #include "Shared/Utils.hpp"
+#include "Solution/Incumbent.hpp"
 #include "Solution/SolutionChecker.hpp"
+#include "SolverBackends.hpp"
+#include "SolverPortfolio.hpp"
 #include <Shared/Utils.hpp>
+#include <algorithm>
 #include <filesystem>
 #include <format>
 #include <fstream>
 #include <loguru.hpp>
+#include <optional>
 #include <rapidjson/document.h>
 #include <rapidjson/filereadstream.h>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 static const std::unordered_set<std::string, StringHash, std::equal_to<>> program_tasks_set = {"solver", "generator"};
 static const std::unordered_set<std::string, StringHash, std::equal_to<>> verbosity_levels_set = {"debug", "info",
                                                                                                   "quiet", "silent"};
+// every backend which can be selected in the solver options, by decreasing priority
+static const std::vector<std::pair<std::string, bool *>> solver_selection_options = {
+    {"portfolio", &Settings::Solver::USE_PORTFOLIO},
+    {"gurobi", &Settings::Solver::USE_GUROBI},
+    {"lns", &Settings::Solver::USE_LNS},
+    {"branch_and_bound", &Settings::Solver::USE_BRANCH_AND_BOUND},
+    {"simulated_annealing", &Settings::Solver::USE_SIMULATED_ANNEALING},
+    {"tabu_search", &Settings::Solver::USE_TABU_SEARCH},
+    {"genetic_algorithm", &Settings::Solver::USE_GENETIC_ALGORITHM},
+    {"priority_rules", &Settings::Solver::USE_PRIORITY_RULES},
+    {"cp", &Settings::Solver::USE_CP}};
 
 static void parse_command_line(std::string &program_task, std::string &program_task_conf, std::string &verbosity_level,
                                int argc, char **argv)
@@ -89,6 +116,10 @@ static bool parse_generator_option_parameters(const std::string &generator_optio
         parse_scalar<size_t>(json_doc_generator_options, "min_nb_resource_units_per_job");
     Settings::FIRST_INSTANCE_INDEX = parse_scalar<size_t>(json_doc_generator_options, "first_instance_index");
     Settings::LAST_INSTANCE_INDEX = parse_scalar<size_t>(json_doc_generator_options, "last_instance_index");
+    if (json_doc_generator_options.HasMember("random_seed"))
+    {
+        Settings::RANDOM_SEED = parse_scalar<size_t>(json_doc_generator_options, "random_seed");
+    }
 
     return true;
 }
@@ -104,23 +135,31 @@ static bool parse_solver_option_parameters(const std::string &solver_options)
     Settings::INSTANCES_DIRECTORY_PATH = parse_scalar<std::string>(json_doc_solver_options, "instances_directory_path");
     Settings::FIRST_INSTANCE_INDEX = parse_scalar<size_t>(json_doc_solver_options, "first_instance_index");
     Settings::LAST_INSTANCE_INDEX = parse_scalar<size_t>(json_doc_solver_options, "last_instance_index");
+    if (json_doc_solver_options.HasMember("random_seed"))
+    {
+        Settings::RANDOM_SEED = parse_scalar<size_t>(json_doc_solver_options, "random_seed");
+    }
     Settings::Solver::RESULTS_DIRECTORY = parse_scalar<std::string>(json_doc_solver_options, "results_directory");
     Settings::Solver::NB_THREADS = parse_scalar<size_t>(json_doc_solver_options, "nb_of_thread");
     Settings::Solver::MAX_RUNTIME = parse_scalar<double>(json_doc_solver_options, "max_runtime");
     Settings::Solver::INIT_ILP_SOLUTION = parse_scalar<bool>(json_doc_solver_options, "init_ilp_solution");
     Settings::Solver::ILP_RELATIVE_GAP = parse_scalar<double>(json_doc_solver_options, "ilp_relative_gap");
 
-    if (json_doc_solver_options.HasMember("use_gurobi"))
+    bool backend_selected = false;
+    for (const auto &[backend_name, selected] : solver_selection_options)
     {
-        Settings::Solver::USE_GUROBI = parse_scalar<bool>(json_doc_solver_options, "use_gurobi");
-    }
-
-    if (json_doc_solver_options.HasMember("use_gurobi"))
-    {
-        Settings::Solver::USE_CP = parse_scalar<bool>(json_doc_solver_options, "use_cp");
+        const std::string option_name = std::format("use_{}", backend_name);
+        if (json_doc_solver_options.HasMember(option_name.c_str()))
+        {
+            *selected = parse_scalar<bool>(json_doc_solver_options, option_name);
+        }
+        PPK_ASSERT_ERROR(!*selected || SolverBackendRegistry::is_available(backend_name),
+                         "Invalid solver options: the %s backend is not available in this build (available: %s)",
+                         backend_name.c_str(), SolverBackendRegistry::get_available_backends_as_string().c_str());
+        backend_selected = backend_selected || *selected;
     }
-
-    PPK_ASSERT_ERROR(Settings::Solver::USE_GUROBI || Settings::Solver::USE_CP, "Either Gurobi or CP must be selected");
+    PPK_ASSERT_ERROR(backend_selected, "Invalid solver options: one of the backends must be selected (available: %s)",
+                     SolverBackendRegistry::get_available_backends_as_string().c_str());
 
     if (json_doc_solver_options.HasMember("check_solution"))
     {
@@ -128,11 +167,240 @@ static bool parse_solver_option_parameters(const std::string &solver_options)
         Settings::Solver::CHECK_SOLUTION = parse_scalar<bool>(json_doc_solver_options, "check_solution");
     }
 
+    if (json_doc_solver_options.HasMember("justify_schedule"))
+    {
+        Settings::Solver::JUSTIFY_SCHEDULE = parse_scalar<bool>(json_doc_solver_options, "justify_schedule");
+    }
+
     if (json_doc_solver_options.HasMember("draw_gantt_chart"))
     {
         Settings::Solver::DRAW_GANTT_CHART = parse_scalar<bool>(json_doc_solver_options, "draw_gantt_chart");
     }
 
+    if (json_doc_solver_options.HasMember("write_convergence"))
+    {
+        Settings::Solver::WRITE_CONVERGENCE = parse_scalar<bool>(json_doc_solver_options, "write_convergence");
+    }
+
+    if (json_doc_solver_options.HasMember("ilp_presolve"))
+    {
+        Settings::Solver::ILP_PRESOLVE = parse_scalar<bool>(json_doc_solver_options, "ilp_presolve");
+    }
+
+    if (json_doc_solver_options.HasMember("ilp_formulation"))
+    {
+        Settings::Solver::ILP_FORMULATION = parse_scalar<std::string>(json_doc_solver_options, "ilp_formulation");
+        PPK_ASSERT_ERROR(ProblemSolverILP::get_formulation_registry().contains(Settings::Solver::ILP_FORMULATION),
+                         "Invalid solver options: unknown ILP formulation %s",
+                         Settings::Solver::ILP_FORMULATION.c_str());
+    }
+
+    if (json_doc_solver_options.HasMember("ilp_model_cache_directory"))
+    {
+        Settings::Solver::ILP_MODEL_CACHE_DIRECTORY =
+            parse_scalar<std::string>(json_doc_solver_options, "ilp_model_cache_directory");
+    }
+
+    if (json_doc_solver_options.HasMember("ilp_lazy_resource_constraints"))
+    {
+        Settings::Solver::ILP_LAZY_RESOURCE_CONSTRAINTS =
+            parse_scalar<bool>(json_doc_solver_options, "ilp_lazy_resource_constraints");
+    }
+
+    PPK_ASSERT_ERROR(!Settings::Solver::ILP_LAZY_RESOURCE_CONSTRAINTS ||
+                         ProblemSolverILP::get_formulation_registry()
+                             .at(Settings::Solver::ILP_FORMULATION)
+                             .supports_lazy_resource_constraints,
+                     "Invalid solver options: the %s formulation does not support lazy resource constraints",
+                     Settings::Solver::ILP_FORMULATION.c_str());
+
+    if (json_doc_solver_options.HasMember("cp_workers"))
+    {
+        Settings::Solver::CP_WORKERS = parse_scalar<size_t>(json_doc_solver_options, "cp_workers");
+    }
+
+    if (json_doc_solver_options.HasMember("cp_search_type"))
+    {
+        Settings::Solver::CP_SEARCH_TYPE = parse_scalar<std::string>(json_doc_solver_options, "cp_search_type");
+#ifdef MRCPSP_HAS_CPLEX
+        PPK_ASSERT_ERROR(CPSolver::get_search_types().contains(Settings::Solver::CP_SEARCH_TYPE),
+                         "Invalid solver options: unknown CP search type %s", Settings::Solver::CP_SEARCH_TYPE.c_str());
+#endif
+    }
+
+    if (json_doc_solver_options.HasMember("cp_deterministic_parallel"))
+    {
+        Settings::Solver::CP_DETERMINISTIC_PARALLEL =
+            parse_scalar<bool>(json_doc_solver_options, "cp_deterministic_parallel");
+    }
+
+    if (json_doc_solver_options.HasMember("cp_redundant_cumulative"))
+    {
+        Settings::Solver::CP_REDUNDANT_CUMULATIVE =
+            parse_scalar<bool>(json_doc_solver_options, "cp_redundant_cumulative");
+    }
+
+    if (json_doc_solver_options.HasMember("cp_makespan_lower_bound"))
+    {
+        Settings::Solver::CP_MAKESPAN_LOWER_BOUND =
+            parse_scalar<bool>(json_doc_solver_options, "cp_makespan_lower_bound");
+    }
+
+    if (json_doc_solver_options.HasMember("cp_transitive_reduction"))
+    {
+        Settings::Solver::CP_TRANSITIVE_REDUCTION =
+            parse_scalar<bool>(json_doc_solver_options, "cp_transitive_reduction");
+    }
+
+    if (json_doc_solver_options.HasMember("cp_unary_no_overlap"))
+    {
+        Settings::Solver::CP_UNARY_NO_OVERLAP = parse_scalar<bool>(json_doc_solver_options, "cp_unary_no_overlap");
+    }
+
+    if (json_doc_solver_options.HasMember("cp_search_phase"))
+    {
+        Settings::Solver::CP_SEARCH_PHASE = parse_scalar<std::string>(json_doc_solver_options, "cp_search_phase");
+#ifdef MRCPSP_HAS_CPLEX
+        PPK_ASSERT_ERROR(CPSolver::get_task_ordering_rules().contains(Settings::Solver::CP_SEARCH_PHASE),
+                         "Invalid solver options: unknown CP search phase %s",
+                         Settings::Solver::CP_SEARCH_PHASE.c_str());
+#endif
+    }
+
+    if (json_doc_solver_options.HasMember("cp_mode_preference"))
+    {
+        Settings::Solver::CP_MODE_PREFERENCE =
+            parse_scalar<std::string>(json_doc_solver_options, "cp_mode_preference");
+#ifdef MRCPSP_HAS_CPLEX
+        PPK_ASSERT_ERROR(CPSolver::get_mode_preference_rules().contains(Settings::Solver::CP_MODE_PREFERENCE),
+                         "Invalid solver options: unknown CP mode preference %s",
+                         Settings::Solver::CP_MODE_PREFERENCE.c_str());
+#endif
+    }
+
+    if (json_doc_solver_options.HasMember("lns_workers"))
+    {
+        Settings::Solver::LNS_WORKERS = parse_scalar<size_t>(json_doc_solver_options, "lns_workers");
+    }
+
+    if (json_doc_solver_options.HasMember("lns_neighbourhood_size"))
+    {
+        Settings::Solver::LNS_NEIGHBOURHOOD_SIZE =
+            parse_scalar<size_t>(json_doc_solver_options, "lns_neighbourhood_size");
+        PPK_ASSERT_ERROR(Settings::Solver::LNS_NEIGHBOURHOOD_SIZE > 0,
+                         "Invalid solver options: the LNS neighbourhood size must be positive");
+    }
+
+    if (json_doc_solver_options.HasMember("lns_iteration_time_limit"))
+    {
+        Settings::Solver::LNS_ITERATION_TIME_LIMIT =
+            parse_scalar<double>(json_doc_solver_options, "lns_iteration_time_limit");
+        PPK_ASSERT_ERROR(Settings::Solver::LNS_ITERATION_TIME_LIMIT > 0.0,
+                         "Invalid solver options: the LNS iteration time limit must be positive");
+    }
+
+    if (json_doc_solver_options.HasMember("branch_and_bound_workers"))
+    {
+        Settings::Solver::BRANCH_AND_BOUND_WORKERS =
+            parse_scalar<size_t>(json_doc_solver_options, "branch_and_bound_workers");
+    }
+
+    if (json_doc_solver_options.HasMember("branch_and_bound_cutset_limit"))
+    {
+        Settings::Solver::BRANCH_AND_BOUND_CUTSET_LIMIT =
+            parse_scalar<size_t>(json_doc_solver_options, "branch_and_bound_cutset_limit");
+    }
+
+    if (json_doc_solver_options.HasMember("priority_rule_passes"))
+    {
+        Settings::Solver::PRIORITY_RULE_PASSES = parse_scalar<size_t>(json_doc_solver_options, "priority_rule_passes");
+        PPK_ASSERT_ERROR(Settings::Solver::PRIORITY_RULE_PASSES > 0,
+                         "Invalid solver options: at least one priority rule pass is required");
+    }
+
+    if (json_doc_solver_options.HasMember("ga_islands"))
+    {
+        Settings::Solver::GA_ISLANDS = parse_scalar<size_t>(json_doc_solver_options, "ga_islands");
+    }
+
+    if (json_doc_solver_options.HasMember("ga_population_size"))
+    {
+        Settings::Solver::GA_POPULATION_SIZE = parse_scalar<size_t>(json_doc_solver_options, "ga_population_size");
+        PPK_ASSERT_ERROR(Settings::Solver::GA_POPULATION_SIZE >= 2,
+                         "Invalid solver options: the GA population needs at least two individuals");
+    }
+
+    if (json_doc_solver_options.HasMember("ga_mutation_probability"))
+    {
+        Settings::Solver::GA_MUTATION_PROBABILITY =
+            parse_scalar<double>(json_doc_solver_options, "ga_mutation_probability");
+        PPK_ASSERT_ERROR(Settings::Solver::GA_MUTATION_PROBABILITY >= 0.0 &&
+                             Settings::Solver::GA_MUTATION_PROBABILITY <= 1.0,
+                         "Invalid solver options: the GA mutation probability must be between 0 and 1");
+    }
+
+    if (json_doc_solver_options.HasMember("ga_migration_interval"))
+    {
+        Settings::Solver::GA_MIGRATION_INTERVAL =
+            parse_scalar<size_t>(json_doc_solver_options, "ga_migration_interval");
+        PPK_ASSERT_ERROR(Settings::Solver::GA_MIGRATION_INTERVAL > 0,
+                         "Invalid solver options: the GA migration interval must be positive");
+    }
+
+    if (json_doc_solver_options.HasMember("sa_replicas"))
+    {
+        Settings::Solver::SA_REPLICAS = parse_scalar<size_t>(json_doc_solver_options, "sa_replicas");
+    }
+
+    if (json_doc_solver_options.HasMember("sa_initial_temperature"))
+    {
+        Settings::Solver::SA_INITIAL_TEMPERATURE =
+            parse_scalar<double>(json_doc_solver_options, "sa_initial_temperature");
+    }
+
+    if (json_doc_solver_options.HasMember("sa_final_temperature"))
+    {
+        Settings::Solver::SA_FINAL_TEMPERATURE = parse_scalar<double>(json_doc_solver_options, "sa_final_temperature");
+    }
+
+    PPK_ASSERT_ERROR(Settings::Solver::SA_FINAL_TEMPERATURE > 0.0 &&
+                         Settings::Solver::SA_FINAL_TEMPERATURE <= Settings::Solver::SA_INITIAL_TEMPERATURE,
+                     "Invalid solver options: the SA temperatures must be positive and decreasing");
+
+    if (json_doc_solver_options.HasMember("sa_round_moves"))
+    {
+        Settings::Solver::SA_ROUND_MOVES = parse_scalar<size_t>(json_doc_solver_options, "sa_round_moves");
+        PPK_ASSERT_ERROR(Settings::Solver::SA_ROUND_MOVES > 0,
+                         "Invalid solver options: the SA rounds need at least one move");
+    }
+
+    if (json_doc_solver_options.HasMember("tabu_search_workers"))
+    {
+        Settings::Solver::TABU_SEARCH_WORKERS = parse_scalar<size_t>(json_doc_solver_options, "tabu_search_workers");
+    }
+
+    if (json_doc_solver_options.HasMember("tabu_search_candidates"))
+    {
+        Settings::Solver::TABU_SEARCH_CANDIDATES =
+            parse_scalar<size_t>(json_doc_solver_options, "tabu_search_candidates");
+        PPK_ASSERT_ERROR(Settings::Solver::TABU_SEARCH_CANDIDATES > 0,
+                         "Invalid solver options: the tabu search needs at least one candidate per iteration");
+    }
+
+    if (json_doc_solver_options.HasMember("tabu_search_tenure"))
+    {
+        Settings::Solver::TABU_SEARCH_TENURE = parse_scalar<size_t>(json_doc_solver_options, "tabu_search_tenure");
+        PPK_ASSERT_ERROR(Settings::Solver::TABU_SEARCH_TENURE > 0,
+                         "Invalid solver options: the tabu tenure must be positive");
+    }
+
+    if (json_doc_solver_options.HasMember("portfolio_backends"))
+    {
+        Settings::Solver::PORTFOLIO_BACKENDS = parse_scalar<std::string>(json_doc_solver_options, "portfolio_backends");
+        // rejects the unknown backends before any instance is read
+        SolverPortfolio::parse_backend_names(Settings::Solver::PORTFOLIO_BACKENDS);
+    }
+
     return true;
 }
 
@@ -152,7 +420,7 @@ static void run_generator(const std::string &program_task_options)
         {
             std::string file_name = std::format("{}instance_{}.json", Settings::INSTANCES_DIRECTORY_PATH, index);
             LOG_F(INFO, "file name = %s", file_name.c_str());
-            InstanceGenerator generator(file_name);
+            InstanceGenerator generator(file_name, make_seed(index));
             generator.generate();
         }
     }
@@ -165,6 +433,121 @@ static bool run_solution_checker(const ProblemInstance &problem_instance, const
     return true;
 }
 
+template <typename SolverType>
+static void connect_solver(SolverType &solver, const std::string &solver_name, const SolverContext &context)
+{
+    solver.add_incumbent_listener(make_incumbent_logger(solver_name));
+    solver.add_incumbent_listener(context.incumbent_store.get_listener());
+    for (const auto &listener : context.incumbent_listeners)
+    {
+        solver.add_incumbent_listener(listener);
+    }
+    solver.set_stop_token(context.stop_token);
+}
+
+// the best schedule published to the store so far, without job allocations when there is none
+static Solution get_store_solution(const SolverContext &context)
+{
+    Solution solution;
+    if (const std::optional<Incumbent> best = context.incumbent_store.get_best(); best.has_value())
+    {
+        solution.solution_state = SolutionState::FEASIBLE;
+        solution.makespan = best->makespan;
+        solution.objective_bound = best->bound;
+        solution.job_allocations = best->job_allocations;
+    }
+    return solution;
+}
+
+// the native engines are always available, the commercial ones only when their library was found at build time
+static void register_solver_backends()
+{
+    SolverBackendRegistry::register_backend(
+        {"branch_and_bound", [](const ProblemInstance &problem_instance, const SolverContext &context) {
+             BranchAndBound branch_and_bound(problem_instance);
+             connect_solver(branch_and_bound, "BranchAndBound", context);
+             branch_and_bound.set_incumbent_source(context.incumbent_store);
+             return branch_and_bound.solve();
+         }});
+    SolverBackendRegistry::register_backend(
+        {"priority_rules", [](const ProblemInstance &problem_instance, const SolverContext &context) {
+             PriorityRuleHeuristic heuristic(problem_instance);
+             connect_solver(heuristic, "PriorityRules", context);
+             heuristic.set_seed(context.seed);
+             return heuristic.solve();
+         }});
+    SolverBackendRegistry::register_backend(
+        {"genetic_algorithm", [](const ProblemInstance &problem_instance, const SolverContext &context) {
+             GeneticAlgorithm genetic_algorithm(problem_instance);
+             connect_solver(genetic_algorithm, "GeneticAlgorithm", context);
+             genetic_algorithm.set_incumbent_source(context.incumbent_store);
+             genetic_algorithm.set_seed(context.seed);
+             return genetic_algorithm.solve();
+         }});
+    SolverBackendRegistry::register_backend(
+        {"simulated_annealing", [](const ProblemInstance &problem_instance, const SolverContext &context) {
+             SimulatedAnnealing simulated_annealing(problem_instance);
+             connect_solver(simulated_annealing, "SimulatedAnnealing", context);
+             simulated_annealing.set_incumbent_source(context.incumbent_store);
+             simulated_annealing.set_seed(context.seed);
+             return simulated_annealing.solve();
+         }});
+    SolverBackendRegistry::register_backend(
+        {"tabu_search", [](const ProblemInstance &problem_instance, const SolverContext &context) {
+             TabuSearch tabu_search(problem_instance);
+             connect_solver(tabu_search, "TabuSearch", context);
+             tabu_search.set_incumbent_source(context.incumbent_store);
+             tabu_search.set_seed(context.seed);
+             return tabu_search.solve();
+         }});
+#ifdef MRCPSP_HAS_GUROBI
+    SolverBackendRegistry::register_backend(
+        {"gurobi", [](const ProblemInstance &problem_instance, const SolverContext &context) {
+             Solution initSol = get_store_solution(context);
+             if (Settings::Solver::INIT_ILP_SOLUTION && initSol.job_allocations.empty())
+             {
+                 initSol = PriorityRuleHeuristic(problem_instance).solve();
+             }
+             ProblemSolverILP ilpSolver(problem_instance);
+             connect_solver(ilpSolver, "ILP", context);
+             return ilpSolver.solve(initSol);
+         }});
+#endif
+#ifdef MRCPSP_HAS_CPLEX
+    SolverBackendRegistry::register_backend(
+        {"lns", [](const ProblemInstance &problem_instance, const SolverContext &context) {
+             LargeNeighbourhoodSearch lns(problem_instance);
+             connect_solver(lns, "LNS", context);
+             lns.set_incumbent_source(context.incumbent_store);
+             lns.set_seed(context.seed);
+             return lns.solve(get_store_solution(context));
+         }});
+    SolverBackendRegistry::register_backend(
+        {"cp", [](const ProblemInstance &problem_instance, const SolverContext &context) {
+             CPSolver solver(problem_instance);
+             connect_solver(solver, "CP", context);
+             if (const Solution start = get_store_solution(context); !start.job_allocations.empty())
+             {
+                 solver.set_starting_point(start);
+             }
+             return solver.solve();
+         }});
+#endif
+    SolverBackendRegistry::register_backend(
+        {"portfolio", [](const ProblemInstance &problem_instance, const SolverContext &context) {
+             const SolverPortfolio portfolio(
+                 problem_instance, SolverPortfolio::parse_backend_names(Settings::Solver::PORTFOLIO_BACKENDS));
+             return portfolio.solve(context);
+         }});
+}
+
+static const SolverBackend &get_selected_backend()
+{
+    auto it = std::ranges::find_if(solver_selection_options, [](const auto &option) { return *option.second; });
+    PPK_ASSERT_ERROR(it != solver_selection_options.end(), "No solver backend selected");
+    return SolverBackendRegistry::get_backend(it->first);
+}
+
 static void write_results(const ProblemInstance &problem_instance, const std::string &short_instance_name,
                           Solution &solution)
 {
@@ -182,7 +565,9 @@ static void write_results(const ProblemInstance &problem_instance, const std::st
 
 static void run_solver(const std::string &program_task_options)
 {
+    register_solver_backends();
     parse_solver_option_parameters(program_task_options);
+    const SolverBackend &backend = get_selected_backend();
 
     std::filesystem::create_directories(Settings::Solver::RESULTS_DIRECTORY);
 
@@ -196,24 +581,26 @@ static void run_solver(const std::string &program_task_options)
         reader.read(problem_instance);
         PPK_ASSERT_ERROR(problem_instance.validate_problem_instance(), "Invalid problem instance");
         Solution solution;
-        if (Settings::Solver::USE_GUROBI)
-        {
-            Solution initSol;
-            if (Settings::Solver::INIT_ILP_SOLUTION)
-            {
-                // TODO
-            }
-            ProblemSolverILP ilpSolver(problem_instance);
-            solution = ilpSolver.solve(initSol);
+        IncumbentStore incumbent_store;
+        solution = backend.solve(problem_instance, SolverContext{incumbent_store, {}, {}, make_seed(index)});
 
-        } else if (Settings::Solver::USE_CP)
+        if (Settings::Solver::WRITE_CONVERGENCE)
         {
-            CPSolver solver(problem_instance);
-            solution = solver.solve();
+            write_convergence_to_json(incumbent_store.get_convergence(),
+                                      std::format("{}{}_{}_convergence.json", Settings::Solver::RESULTS_DIRECTORY,
+                                                  Settings::INSTANCE_NAME, index));
         }
 
         if (solution.solution_state == SolutionState::FEASIBLE || solution.solution_state == SolutionState::OPTIMAL)
         {
+            if (Settings::Solver::JUSTIFY_SCHEDULE && solution.solution_state == SolutionState::FEASIBLE)
+            {
+                const size_t makespan = solution.makespan;
+                if (justify_schedule(problem_instance, solution))
+                {
+                    LOG_F(INFO, "justification reduced the makespan from %zu to %zu", makespan, solution.makespan);
+                }
+            }
             LOG_F(INFO, "solution = %s", solution.get_solution_as_string().c_str());
 
             if (Settings::Solver::CHECK_SOLUTION)
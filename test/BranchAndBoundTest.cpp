@@ -0,0 +1,113 @@
+#include "Algorithms/BranchAndBound/BranchAndBound.hpp"
+#include "Algorithms/ScheduleGeneration/ScheduleDecoder.hpp"
+#include "Settings.hpp"
+#include "Solution/SolutionChecker.hpp"
+#include "TestUtils.hpp"
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+// smallest serial SGS makespan over every precedence feasible activity list and every mode assignment, the serial
+// SGS schedules of an instance contain an optimal schedule
+static size_t compute_optimal_makespan(ScheduleDecoder &decoder, std::vector<size_t> &activity_list,
+                                       std::vector<size_t> &nb_unlisted_predecessors)
+{
+    const size_t nb_jobs = decoder.get_nb_jobs();
+    if (activity_list.size() == nb_jobs)
+    {
+        size_t optimal_makespan = std::numeric_limits<size_t>::max();
+        std::vector<size_t> job_modes(nb_jobs, 0);
+        for (;;)
+        {
+            optimal_makespan = std::min(optimal_makespan, decoder.decode(activity_list, job_modes));
+            size_t job_index = 0;
+            while (job_index < nb_jobs && ++job_modes[job_index] == decoder.get_nb_modes(job_index))
+            {
+                job_modes[job_index++] = 0;
+            }
+            if (job_index == nb_jobs)
+            {
+                return optimal_makespan;
+            }
+        }
+    }
+
+    size_t optimal_makespan = std::numeric_limits<size_t>::max();
+    const PrecedenceGraph &precedence_graph = decoder.get_precedence_graph();
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        if (nb_unlisted_predecessors[job_index] != 0 ||
+            std::ranges::find(activity_list, job_index) != activity_list.end())
+        {
+            continue;
+        }
+        activity_list.emplace_back(job_index);
+        for (size_t successor_index : precedence_graph.get_successors(job_index))
+        {
+            --nb_unlisted_predecessors[successor_index];
+        }
+        optimal_makespan =
+            std::min(optimal_makespan, compute_optimal_makespan(decoder, activity_list, nb_unlisted_predecessors));
+        for (size_t successor_index : precedence_graph.get_successors(job_index))
+        {
+            ++nb_unlisted_predecessors[successor_index];
+        }
+        activity_list.pop_back();
+    }
+    return optimal_makespan;
+}
+
+static size_t compute_optimal_makespan(const ProblemInstance &problem_instance)
+{
+    ScheduleDecoder decoder(problem_instance);
+    std::vector<size_t> activity_list;
+    std::vector<size_t> nb_unlisted_predecessors;
+    for (size_t job_index = 0; job_index < decoder.get_nb_jobs(); ++job_index)
+    {
+        nb_unlisted_predecessors.emplace_back(decoder.get_precedence_graph().get_predecessors(job_index).size());
+    }
+    return compute_optimal_makespan(decoder, activity_list, nb_unlisted_predecessors);
+}
+
+int main()
+{
+    Settings::Solver::MAX_RUNTIME = 60;
+    Settings::Solver::NB_THREADS = 2;
+
+    for (uint64_t seed = 1; seed <= 30; ++seed)
+    {
+        TestInstance test_instance = make_random_test_instance(seed, 6, 3, 2, 4, 6);
+        ProblemInstance problem_instance(get_test_instance_path("branch_and_bound"));
+        read_test_instance(problem_instance, test_instance);
+        const size_t optimal_makespan = compute_optimal_makespan(problem_instance);
+
+        BranchAndBound branch_and_bound(problem_instance);
+        const Solution solution = branch_and_bound.solve();
+        CHECK(solution.solution_state == SolutionState::OPTIMAL);
+        CHECK(solution.makespan == optimal_makespan);
+        CHECK(SolutionChecker(problem_instance, solution).check_solution());
+
+        // every job gets a last mode as long as its first one plus one time unit with the same demands, the
+        // dominance filter drops it so that the optimum is found without it
+        for (TestJob &job : test_instance.jobs)
+        {
+            job.durations.emplace_back(job.durations.front() + 1);
+            job.demands.emplace_back(job.demands.front());
+        }
+        ProblemInstance dominated_instance(get_test_instance_path("branch_and_bound_dominated"));
+        read_test_instance(dominated_instance, test_instance);
+
+        BranchAndBound dominated_branch_and_bound(dominated_instance);
+        const Solution dominated_solution = dominated_branch_and_bound.solve();
+        CHECK(dominated_solution.solution_state == SolutionState::OPTIMAL);
+        CHECK(dominated_solution.makespan == optimal_makespan);
+        CHECK(SolutionChecker(dominated_instance, dominated_solution).check_solution());
+        for (const JobAllocation &job_allocation : dominated_solution.job_allocations)
+        {
+            // the 1-based mode ids of the dominated modes are the numbers of modes
+            const TestJob &job = test_instance.jobs[std::stoul(job_allocation.job_id)];
+            CHECK(job_allocation.mode_id < job.durations.size());
+        }
+    }
+    return get_test_result();
+}
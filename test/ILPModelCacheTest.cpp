@@ -0,0 +1,60 @@
+#include "Algorithms/ILPOptimizationModel/ProblemSolverILP.hpp"
+#include "Settings.hpp"
+#include "TestUtils.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <vector>
+
+static std::vector<std::filesystem::path> get_cache_files(const std::filesystem::path &cache_directory)
+{
+    std::vector<std::filesystem::path> cache_files;
+    for (const auto &entry : std::filesystem::directory_iterator(cache_directory))
+    {
+        cache_files.emplace_back(entry.path());
+    }
+    std::ranges::sort(cache_files);
+    return cache_files;
+}
+
+static void construct_model(const TestInstance &test_instance)
+{
+    ProblemInstance problem_instance(get_test_instance_path("ilp_model_cache"));
+    read_test_instance(problem_instance, test_instance);
+    ProblemSolverILP problem_solver(problem_instance);
+}
+
+int main()
+{
+    const std::filesystem::path cache_directory =
+        std::filesystem::temp_directory_path() / "mrcpsp_tests" / "ilp_model_cache";
+    std::filesystem::remove_all(cache_directory);
+    Settings::Solver::ILP_MODEL_CACHE_DIRECTORY = cache_directory.string();
+
+    // the first construction writes the model, no temporary file is left behind
+    const TestInstance test_instance = make_random_test_instance(1, 8, 2, 2, 4, 4);
+    construct_model(test_instance);
+    const std::vector<std::filesystem::path> cache_files = get_cache_files(cache_directory);
+    CHECK(cache_files.size() == 1);
+    CHECK(cache_files.front().string().ends_with(".mps.gz"));
+    CHECK(cache_files.front().string().find(".tmp") == std::string::npos);
+
+    // the same instance reads the cached model, which is neither rewritten nor rejected
+    const auto write_time = std::filesystem::last_write_time(cache_files.front()) - std::chrono::hours(1);
+    std::filesystem::last_write_time(cache_files.front(), write_time);
+    construct_model(test_instance);
+    CHECK(get_cache_files(cache_directory) == cache_files);
+    CHECK(std::filesystem::last_write_time(cache_files.front()) == write_time);
+
+    // other contents in a file of the same name miss the cache and get a model of their own
+    TestInstance changed_instance = test_instance;
+    ++changed_instance.jobs.front().durations.front();
+    construct_model(changed_instance);
+    const std::vector<std::filesystem::path> changed_cache_files = get_cache_files(cache_directory);
+    CHECK(changed_cache_files.size() == 2);
+    CHECK(std::ranges::includes(changed_cache_files, cache_files));
+    CHECK(std::filesystem::last_write_time(cache_files.front()) == write_time);
+
+    std::filesystem::remove_all(cache_directory);
+    return get_test_result();
+}
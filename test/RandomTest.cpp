@@ -0,0 +1,78 @@
+#include "Shared/Random.hpp"
+#include "TestUtils.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+int main()
+{
+    RandomGenerator generator(42);
+
+    // bounded draws stay below their bound, including the bounds which reject almost half of the raw draws
+    const size_t bounds[] = {1, 2, 3, 7, 1000, (size_t{1} << 63) + 1, std::numeric_limits<size_t>::max()};
+    for (size_t bound : bounds)
+    {
+        double mean = 0.0;
+        for (size_t draw_index = 0; draw_index < 100000; ++draw_index)
+        {
+            const size_t value = generator.uniform_index(bound);
+            CHECK(value < bound);
+            mean += static_cast<double>(value) / static_cast<double>(bound) / 100000.0;
+        }
+        const double expected_mean = static_cast<double>(bound - 1) / static_cast<double>(bound) / 2.0;
+        CHECK(std::abs(mean - expected_mean) < 0.01);
+    }
+
+    // every value of a small bound is drawn equally often
+    std::vector<size_t> counts(7, 0);
+    for (size_t draw_index = 0; draw_index < 700000; ++draw_index)
+    {
+        ++counts[generator.uniform_index(counts.size())];
+    }
+    for (size_t count : counts)
+    {
+        CHECK(count > 99000 && count < 101000);
+    }
+
+    // closed integer ranges, the full range of a type included
+    CHECK(generator.uniform_int(-3, -3) == -3);
+    bool negative_drawn = false;
+    bool positive_drawn = false;
+    for (size_t draw_index = 0; draw_index < 1000; ++draw_index)
+    {
+        const int value = generator.uniform_int(-5, 5);
+        CHECK(value >= -5 && value <= 5);
+        const int64_t full_range_value =
+            generator.uniform_int(std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max());
+        negative_drawn |= full_range_value < 0;
+        positive_drawn |= full_range_value > 0;
+    }
+    CHECK(negative_drawn && positive_drawn);
+
+    // the draws of a weighted index follow the weights, a zero weight is never drawn
+    const std::vector<double> cumulative_weights = {1.0, 1.0, 4.0, 10.0};
+    std::vector<size_t> weighted_counts(cumulative_weights.size(), 0);
+    for (size_t draw_index = 0; draw_index < 1000000; ++draw_index)
+    {
+        ++weighted_counts[generator.weighted_index(cumulative_weights)];
+    }
+    CHECK(weighted_counts[1] == 0);
+    CHECK(weighted_counts[0] > 97000 && weighted_counts[0] < 103000);
+    CHECK(weighted_counts[2] > 297000 && weighted_counts[2] < 303000);
+    CHECK(weighted_counts[3] > 597000 && weighted_counts[3] < 603000);
+
+    // a seed and a stream give one sequence, the streams of a seed differ
+    RandomGenerator first(7, 0);
+    RandomGenerator second(7, 0);
+    RandomGenerator other_stream(7, 1);
+    bool streams_differ = false;
+    for (size_t draw_index = 0; draw_index < 100; ++draw_index)
+    {
+        const uint64_t value = first();
+        CHECK(value == second());
+        streams_differ |= value != other_stream();
+    }
+    CHECK(streams_differ);
+    return get_test_result();
+}
@@ -0,0 +1,205 @@
+#include "Shared/Random.hpp"
+#include "Shared/ResourceProfile.hpp"
+#include "TestUtils.hpp"
+#include <limits>
+#include <optional>
+#include <vector>
+
+struct Placement
+{
+    size_t row;
+    size_t first;
+    size_t last;
+};
+
+// usages kept in size_t units, a row fits wherever no usage plus demand exceeds its capacity
+class NaiveProfile
+{
+  public:
+    NaiveProfile(const std::vector<size_t> &capacities, const std::vector<size_t> &demands, size_t horizon)
+        : capacities(capacities), demands(demands), usages(horizon * capacities.size(), 0)
+    {
+    }
+
+    bool exceeds(size_t row, size_t time) const
+    {
+        const size_t nb_resources = capacities.size();
+        for (size_t r = 0; r < nb_resources; ++r)
+        {
+            // the usages never exceed the capacities, the demands may be as large as size_t allows
+            if (demands[row * nb_resources + r] > capacities[r] - usages[time * nb_resources + r])
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool fits(size_t row, size_t first, size_t last) const
+    {
+        for (size_t t = first; t < last; ++t)
+        {
+            if (exceeds(row, t))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::optional<size_t> find_earliest_start(size_t row, size_t duration, size_t earliest_start) const
+    {
+        const size_t horizon = usages.size() / capacities.size();
+        for (size_t start_time = earliest_start; start_time + duration <= horizon; ++start_time)
+        {
+            if (fits(row, start_time, start_time + duration))
+            {
+                return start_time;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void update(const Placement &placement, bool adding)
+    {
+        const size_t nb_resources = capacities.size();
+        for (size_t t = placement.first; t < placement.last; ++t)
+        {
+            for (size_t r = 0; r < nb_resources; ++r)
+            {
+                size_t &usage = usages[t * nb_resources + r];
+                const size_t demand = demands[placement.row * nb_resources + r];
+                usage = adding ? usage + demand : usage - demand;
+            }
+        }
+    }
+
+  private:
+    std::vector<size_t> capacities;
+    std::vector<size_t> demands;
+    std::vector<size_t> usages;
+};
+
+template <typename Unit> void test_resource_profile(uint64_t seed)
+{
+    constexpr size_t max_capacity = ResourceProfile<Unit>::max_capacity;
+    constexpr size_t nb_resources = 21;
+    constexpr size_t horizon = 40;
+    RandomGenerator generator(seed);
+
+    // capacities at and just below the largest one of the unit, one resource past a whole vector of 8 bit units
+    std::vector<size_t> capacities;
+    for (size_t r = 0; r < nb_resources; ++r)
+    {
+        capacities.emplace_back(max_capacity - generator.uniform_index(3));
+    }
+
+    // row 0 demands every capacity, row 1 one unit more than a capacity, row 2 far more, row 3 nothing, the
+    // other rows fractions of the capacities so that a few of them add up to the capacities
+    std::vector<size_t> demands;
+    for (size_t r = 0; r < nb_resources; ++r)
+    {
+        demands.emplace_back(capacities[r]);
+    }
+    for (size_t r = 0; r < nb_resources; ++r)
+    {
+        demands.emplace_back(r == nb_resources - 1 ? capacities[r] + 1 : 0);
+    }
+    for (size_t r = 0; r < nb_resources; ++r)
+    {
+        demands.emplace_back(r == 0 ? std::numeric_limits<size_t>::max() : 0);
+    }
+    demands.insert(demands.end(), nb_resources, 0);
+    constexpr size_t nb_random_rows = 8;
+    for (size_t row = 0; row < nb_random_rows; ++row)
+    {
+        for (size_t r = 0; r < nb_resources; ++r)
+        {
+            const size_t divisors[] = {1, 2, 3, 4};
+            demands.emplace_back(generator.bernoulli(0.3) ? 0 : capacities[r] / divisors[generator.uniform_index(4)]);
+        }
+    }
+    const size_t nb_rows = demands.size() / nb_resources;
+
+    ResourceProfile<Unit> profile(capacities, demands, horizon);
+    NaiveProfile naive_profile(capacities, demands, horizon);
+
+    // a row demanding every capacity fits an empty profile, a row exceeding a capacity never does
+    CHECK(profile.fits(0, 0, horizon));
+    CHECK(!profile.fits(1, 0, 1));
+    CHECK(!profile.fits(2, 0, 1));
+    CHECK(profile.fits(3, 0, horizon));
+    profile.add(0, 0, horizon);
+    CHECK(!profile.exceeds(3, horizon - 1));
+    for (size_t row = 0; row < nb_rows; ++row)
+    {
+        CHECK(profile.fits(row, 0, horizon) == (row == 3));
+    }
+    profile.remove(0, 0, horizon);
+    CHECK(profile.fits(0, 0, horizon));
+
+    // random placements and removals agree with the naive usages at every time point
+    std::vector<Placement> placements;
+    for (size_t operation_index = 0; operation_index < 2000; ++operation_index)
+    {
+        const size_t row = generator.uniform_index(nb_rows);
+        const size_t duration = 1 + generator.uniform_index(8);
+        const size_t earliest_start = generator.uniform_index(horizon - duration + 1);
+        for (size_t t = 0; t < horizon; ++t)
+        {
+            CHECK(profile.exceeds(row, t) == naive_profile.exceeds(row, t));
+        }
+        CHECK(profile.fits(row, earliest_start, earliest_start + duration) ==
+              naive_profile.fits(row, earliest_start, earliest_start + duration));
+
+        const std::optional<size_t> start_time = naive_profile.find_earliest_start(row, duration, earliest_start);
+        if (!placements.empty() && (!start_time || generator.bernoulli(0.4)))
+        {
+            const size_t placement_index = generator.uniform_index(placements.size());
+            const Placement placement = placements[placement_index];
+            placements[placement_index] = placements.back();
+            placements.pop_back();
+            profile.remove(placement.row, placement.first, placement.last);
+            naive_profile.update(placement, false);
+        }
+        else if (start_time)
+        {
+            // the search aborts when no start time fits within the horizon, so it only runs when one does
+            CHECK(profile.find_earliest_start(row, duration, earliest_start) == *start_time);
+            const Placement placement{row, *start_time, *start_time + duration};
+            profile.add(placement.row, placement.first, placement.last);
+            naive_profile.update(placement, true);
+            placements.emplace_back(placement);
+        }
+    }
+
+    // clearing a prefix empties it and leaves the rest
+    profile.clear(horizon / 2);
+    for (size_t t = 0; t < horizon; ++t)
+    {
+        CHECK(profile.exceeds(0, t) == (t >= horizon / 2 && naive_profile.exceeds(0, t)));
+    }
+}
+
+int main()
+{
+    // the narrowest unit whose largest capacity holds the largest capacity of the instance is picked
+    const std::vector<size_t> no_demands;
+    CHECK(make_resource_profile({}, no_demands, 1).index() == 0);
+    CHECK(make_resource_profile({ResourceProfile<int8_t>::max_capacity}, no_demands, 1).index() == 0);
+    CHECK(make_resource_profile({ResourceProfile<int8_t>::max_capacity + 1}, no_demands, 1).index() == 1);
+    CHECK(make_resource_profile({ResourceProfile<int16_t>::max_capacity}, no_demands, 1).index() == 1);
+    CHECK(make_resource_profile({ResourceProfile<int16_t>::max_capacity + 1}, no_demands, 1).index() == 2);
+    CHECK(make_resource_profile({ResourceProfile<int32_t>::max_capacity}, no_demands, 1).index() == 2);
+    CHECK(make_resource_profile({ResourceProfile<int32_t>::max_capacity + 1}, no_demands, 1).index() == 3);
+    CHECK(make_resource_profile({1, ResourceProfile<int16_t>::max_capacity + 1}, no_demands, 1).index() == 2);
+
+    for (uint64_t seed = 1; seed <= 10; ++seed)
+    {
+        test_resource_profile<int8_t>(seed);
+        test_resource_profile<int16_t>(seed);
+        test_resource_profile<int32_t>(seed);
+        test_resource_profile<int64_t>(seed);
+    }
+    return get_test_result();
+}
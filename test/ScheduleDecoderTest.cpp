@@ -0,0 +1,46 @@
+#include "Algorithms/ScheduleGeneration/ScheduleDecoder.hpp"
+#include "Algorithms/ScheduleGeneration/ScheduleEncoding.hpp"
+#include "Algorithms/ScheduleGeneration/ScheduleNeighbourhood.hpp"
+#include "TestUtils.hpp"
+#include <vector>
+
+int main()
+{
+    // the capacities select every width of resource profile units
+    const size_t capacities[] = {3, 200, 40000, 3000000000};
+    for (size_t capacity : capacities)
+    {
+        for (uint64_t seed = 1; seed <= 10; ++seed)
+        {
+            ProblemInstance problem_instance(get_test_instance_path("schedule_decoder"));
+            read_test_instance(problem_instance, make_random_test_instance(seed, 30, 4, 3, capacity, 8));
+            ScheduleDecoder decoder(problem_instance);
+            ScheduleDecoder reference_decoder(problem_instance);
+            RandomGenerator generator(seed);
+
+            ScheduleNeighbourhood neighbourhood(decoder, make_random_encoding(decoder, generator));
+            const ScheduleEncoding &encoding = neighbourhood.get_encoding();
+            decoder.decode(encoding.activity_list, encoding.job_modes);
+            for (size_t move_index = 0; move_index < 500; ++move_index)
+            {
+                // the suffix decode after a move, kept or undone, gives the schedule of a full decode
+                const ScheduleMove move = neighbourhood.sample_move(generator);
+                neighbourhood.apply(move);
+                if (generator.bernoulli(0.5))
+                {
+                    neighbourhood.undo(move);
+                }
+                // a parallel decode in between must not be taken for the last serial schedule
+                if (move_index % 50 == 0)
+                {
+                    decoder.decode_parallel(encoding.activity_list, encoding.job_modes);
+                }
+
+                const size_t makespan = decoder.redecode(encoding.activity_list, encoding.job_modes);
+                CHECK(makespan == reference_decoder.decode(encoding.activity_list, encoding.job_modes));
+                CHECK(decoder.get_start_times() == reference_decoder.get_start_times());
+            }
+        }
+    }
+    return get_test_result();
+}
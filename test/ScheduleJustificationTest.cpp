@@ -0,0 +1,47 @@
+#include "Algorithms/ScheduleGeneration/ScheduleDecoder.hpp"
+#include "Algorithms/ScheduleGeneration/ScheduleEncoding.hpp"
+#include "Algorithms/ScheduleGeneration/ScheduleJustification.hpp"
+#include "Solution/SolutionChecker.hpp"
+#include "TestUtils.hpp"
+#include <algorithm>
+
+int main()
+{
+    size_t nb_improved = 0;
+    for (uint64_t seed = 1; seed <= 20; ++seed)
+    {
+        ProblemInstance problem_instance(get_test_instance_path("schedule_justification"));
+        read_test_instance(problem_instance, make_random_test_instance(seed, 30, 3, 3, 6, 8));
+        ScheduleDecoder decoder(problem_instance);
+        RandomGenerator generator(seed);
+
+        for (size_t encoding_index = 0; encoding_index < 20; ++encoding_index)
+        {
+            const ScheduleEncoding encoding = make_random_encoding(decoder, generator);
+            Solution solution;
+            solution.makespan = encoding_index % 2 == 0
+                                    ? decoder.decode(encoding.activity_list, encoding.job_modes)
+                                    : decoder.decode_parallel(encoding.activity_list, encoding.job_modes);
+            solution.job_allocations = decoder.get_job_allocations(encoding.job_modes);
+            CHECK(SolutionChecker(problem_instance, solution).check_solution());
+
+            // the justified schedule stays feasible, keeps the modes and never ends later
+            const size_t makespan = solution.makespan;
+            const std::vector<JobAllocation> job_allocations = solution.job_allocations;
+            const bool improved = justify_schedule(problem_instance, solution);
+            CHECK(SolutionChecker(problem_instance, solution).check_solution());
+            CHECK(solution.makespan <= makespan);
+            CHECK(improved == (solution.makespan < makespan));
+            CHECK(solution.job_allocations.size() == job_allocations.size());
+            for (const JobAllocation &job_allocation : solution.job_allocations)
+            {
+                const auto it = std::ranges::find(job_allocations, job_allocation.job_id, &JobAllocation::job_id);
+                CHECK(it != job_allocations.end() && it->mode_id == job_allocation.mode_id);
+            }
+            nb_improved += improved ? 1 : 0;
+        }
+    }
+    // random activity lists leave slack which the justification removes from some of the schedules
+    CHECK(nb_improved > 0);
+    return get_test_result();
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "InstanceReader/InstanceReader.hpp"
+#include "ProblemInstance/ProblemInstance.hpp"
+#include "Shared/Random.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// failed checks of the test executable, main returns EXIT_FAILURE when there is any so that ctest reports it
+inline int nb_failed_checks = 0;
+
+#define CHECK(condition)                                                                                              \
+    do                                                                                                                \
+    {                                                                                                                 \
+        if (!(condition))                                                                                             \
+        {                                                                                                             \
+            ++nb_failed_checks;                                                                                       \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);                        \
+        }                                                                                                             \
+    } while (false)
+
+inline int get_test_result() { return nb_failed_checks == 0 ? EXIT_SUCCESS : EXIT_FAILURE; }
+
+// jobs are identified by their index, demands[m][r] is the demand of mode m for resource r
+struct TestJob
+{
+    std::vector<size_t> durations;
+    std::vector<std::vector<size_t>> demands;
+    std::vector<size_t> successors;
+};
+
+struct TestInstance
+{
+    std::vector<size_t> capacities;
+    std::vector<TestJob> jobs;
+};
+
+// the successors of a job have larger indices, every mode demands at most the capacities
+inline TestInstance make_random_test_instance(uint64_t seed, size_t nb_jobs, size_t nb_resources, size_t max_nb_modes,
+                                              size_t capacity, size_t max_duration)
+{
+    RandomGenerator generator(seed);
+    TestInstance test_instance;
+    test_instance.capacities.assign(nb_resources, capacity);
+    for (size_t job_index = 0; job_index < nb_jobs; ++job_index)
+    {
+        TestJob job;
+        const size_t nb_modes = 1 + generator.uniform_index(max_nb_modes);
+        for (size_t mode_index = 0; mode_index < nb_modes; ++mode_index)
+        {
+            job.durations.emplace_back(1 + generator.uniform_index(max_duration));
+            job.demands.emplace_back();
+            for (size_t resource_index = 0; resource_index < nb_resources; ++resource_index)
+            {
+                job.demands.back().emplace_back(generator.uniform_index(capacity + 1));
+            }
+        }
+        for (size_t successor_index = job_index + 1; successor_index < nb_jobs; ++successor_index)
+        {
+            if (generator.bernoulli(0.15))
+            {
+                job.successors.emplace_back(successor_index);
+            }
+        }
+        test_instance.jobs.emplace_back(std::move(job));
+    }
+    return test_instance;
+}
+
+// the file of a test instance, named like the instances main reads
+inline std::string get_test_instance_path(const std::string &name)
+{
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "mrcpsp_tests";
+    std::filesystem::create_directories(directory);
+    return (directory / std::format("{}.json", name)).string();
+}
+
+// writes the test instance in the format of the instance generator to the file the problem instance is named after
+// and reads it back like main does
+inline void read_test_instance(ProblemInstance &problem_instance, const TestInstance &test_instance)
+{
+    std::string content = "{\"res_units\": [";
+    for (size_t resource_index = 0; resource_index < test_instance.capacities.size(); ++resource_index)
+    {
+        content += std::format("{}{}", resource_index > 0 ? ", " : "", test_instance.capacities[resource_index]);
+    }
+    content += "], \"jobs\": [";
+    for (size_t job_index = 0; job_index < test_instance.jobs.size(); ++job_index)
+    {
+        const TestJob &job = test_instance.jobs[job_index];
+        content += std::format("{}{{\"id\": \"{}\", \"modes\": [", job_index > 0 ? ", " : "", job_index);
+        for (size_t mode_index = 0; mode_index < job.demands.size(); ++mode_index)
+        {
+            content += mode_index > 0 ? ", [" : "[";
+            for (size_t resource_index = 0; resource_index < job.demands[mode_index].size(); ++resource_index)
+            {
+                content += std::format("{}{}", resource_index > 0 ? ", " : "", job.demands[mode_index][resource_index]);
+            }
+            content += "]";
+        }
+        content += "], \"processing_time\": [";
+        for (size_t mode_index = 0; mode_index < job.durations.size(); ++mode_index)
+        {
+            content += std::format("{}{}", mode_index > 0 ? ", " : "", job.durations[mode_index]);
+        }
+        content += "], \"succ\": [";
+        for (size_t position = 0; position < job.successors.size(); ++position)
+        {
+            content += std::format("{}\"{}\"", position > 0 ? ", " : "", job.successors[position]);
+        }
+        content += "]}";
+    }
+    content += "]}";
+
+    std::ofstream ofs(problem_instance.get_name());
+    PPK_ASSERT_ERROR(ofs.is_open(), "Failed to open the file %s", problem_instance.get_name().c_str());
+    ofs << content << std::endl;
+    ofs.close();
+
+    InstanceReader reader(problem_instance.get_name());
+    reader.read(problem_instance);
+    PPK_ASSERT_ERROR(problem_instance.validate_problem_instance(), "Invalid test instance");
+}